@@ -5,96 +5,95 @@
 
 #include <algorithm>
 
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/port.h>
-#include <google/protobuf/stubs/once.h>
 #include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/reflection_ops.h>
 #include <google/protobuf/wire_format.h>
-// This is a temporary google only hack
-#ifdef GOOGLE_PROTOBUF_ENFORCE_UNIQUENESS
-#include "third_party/protobuf/version.h"
-#endif
 // @@protoc_insertion_point(includes)
-namespace aelf {
-}  // namespace aelf
-namespace protobuf_aelf_5foptions_2eproto {
-const ::google::protobuf::uint32 TableStruct::offsets[1] = {};
-static const ::google::protobuf::internal::MigrationSchema* schemas = NULL;
-static const ::google::protobuf::Message* const* file_default_instances = NULL;
+#include <google/protobuf/port_def.inc>
 
-void protobuf_AssignDescriptors() {
-  AddDescriptors();
-  ::google::protobuf::MessageFactory* factory = NULL;
-  AssignDescriptors(
-      "aelf_options.proto", schemas, file_default_instances, TableStruct::offsets, factory,
-      NULL, NULL, NULL);
-}
+PROTOBUF_PRAGMA_INIT_SEG
 
-void protobuf_AssignDescriptorsOnce() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &protobuf_AssignDescriptors);
-}
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
 
-void protobuf_RegisterTypes(const ::std::string&) GOOGLE_PROTOBUF_ATTRIBUTE_COLD;
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-}
+namespace aelf {
+}  // namespace aelf
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_aelf_5foptions_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_aelf_5foptions_2eproto = nullptr;
+const uint32_t TableStruct_aelf_5foptions_2eproto::offsets[1] = {};
+static constexpr ::_pbi::MigrationSchema* schemas = nullptr;
+static constexpr ::_pb::Message* const* file_default_instances = nullptr;
 
-void AddDescriptorsImpl() {
-  InitDefaults();
-  static const char descriptor[] GOOGLE_PROTOBUF_ATTRIBUTE_SECTION_VARIABLE(protodesc_cold) = {
-      "\n\022aelf_options.proto\022\004aelf\032 google/proto"
-      "buf/descriptor.proto:/\n\004base\022\037.google.pr"
-      "otobuf.ServiceOptions\030\251\351\036 \003(\t:7\n\014csharp_"
-      "state\022\037.google.protobuf.ServiceOptions\030\306"
-      "\351\036 \001(\t:1\n\007is_view\022\036.google.protobuf.Meth"
-      "odOptions\030\221\361\036 \001(\010:3\n\010is_event\022\037.google.p"
-      "rotobuf.MessageOptions\030\264\207\003 \001(\010:3\n\nis_ind"
-      "exed\022\035.google.protobuf.FieldOptions\030\361\321\036 "
-      "\001(\010"
-  };
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-      descriptor, 323);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "aelf_options.proto", &protobuf_RegisterTypes);
-  ::protobuf_google_2fprotobuf_2fdescriptor_2eproto::AddDescriptors();
+const char descriptor_table_protodef_aelf_5foptions_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022aelf_options.proto\022\004aelf\032 google/proto"
+  "buf/descriptor.proto:/\n\004base\022\037.google.pr"
+  "otobuf.ServiceOptions\030\251\351\036 \003(\t:7\n\014csharp_"
+  "state\022\037.google.protobuf.ServiceOptions\030\306"
+  "\351\036 \001(\t:1\n\007is_view\022\036.google.protobuf.Meth"
+  "odOptions\030\221\361\036 \001(\010:2\n\010base_fee\022\036.google.p"
+  "rotobuf.MethodOptions\030\222\361\036 \001(\003:9\n\017resourc"
+  "e_weight\022\036.google.protobuf.MethodOptions"
+  "\030\223\361\036 \003(\t:4\n\npool_input\022\036.google.protobuf"
+  ".MethodOptions\030\224\361\036 \001(\010:3\n\010is_event\022\037.goo"
+  "gle.protobuf.MessageOptions\030\264\207\003 \001(\010:3\n\ni"
+  "s_indexed\022\035.google.protobuf.FieldOptions"
+  "\030\361\321\036 \001(\010"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_aelf_5foptions_2eproto_deps[1] = {
+  &::descriptor_table_google_2fprotobuf_2fdescriptor_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_aelf_5foptions_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_aelf_5foptions_2eproto = {
+    false, false, 488, descriptor_table_protodef_aelf_5foptions_2eproto,
+    "aelf_options.proto",
+    &descriptor_table_aelf_5foptions_2eproto_once, descriptor_table_aelf_5foptions_2eproto_deps, 1, 0,
+    schemas, file_default_instances, TableStruct_aelf_5foptions_2eproto::offsets,
+    nullptr, file_level_enum_descriptors_aelf_5foptions_2eproto,
+    file_level_service_descriptors_aelf_5foptions_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_aelf_5foptions_2eproto_getter() {
+  return &descriptor_table_aelf_5foptions_2eproto;
 }
 
-void AddDescriptors() {
-  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
-  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
-}
-// Force AddDescriptors() to be called at dynamic initialization time.
-struct StaticDescriptorInitializer {
-  StaticDescriptorInitializer() {
-    AddDescriptors();
-  }
-} static_descriptor_initializer;
-}  // namespace protobuf_aelf_5foptions_2eproto
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_aelf_5foptions_2eproto(&descriptor_table_aelf_5foptions_2eproto);
 namespace aelf {
-const ::std::string base_default("");
-::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
-    ::google::protobuf::internal::RepeatedStringTypeTraits, 9, false >
-  base(kBaseFieldNumber, base_default);
-const ::std::string csharp_state_default("");
-::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::ServiceOptions,
-    ::google::protobuf::internal::StringTypeTraits, 9, false >
-  csharp_state(kCsharpStateFieldNumber, csharp_state_default);
-::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MethodOptions,
-    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
-  is_view(kIsViewFieldNumber, false);
-::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::MessageOptions,
-    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
-  is_event(kIsEventFieldNumber, false);
-::google::protobuf::internal::ExtensionIdentifier< ::google::protobuf::FieldOptions,
-    ::google::protobuf::internal::PrimitiveTypeTraits< bool >, 8, false >
-  is_indexed(kIsIndexedFieldNumber, false);
+const std::string base_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::ServiceOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 9, false>
+  base(kBaseFieldNumber, base_default, nullptr);
+const std::string csharp_state_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::ServiceOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::StringTypeTraits, 9, false>
+  csharp_state(kCsharpStateFieldNumber, csharp_state_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  is_view(kIsViewFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< int64_t >, 3, false>
+  base_fee(kBaseFeeFieldNumber, int64_t{0}, nullptr);
+const std::string resource_weight_default("");
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::RepeatedStringTypeTraits, 9, false>
+  resource_weight(kResourceWeightFieldNumber, resource_weight_default, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MethodOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  pool_input(kPoolInputFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::MessageOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  is_event(kIsEventFieldNumber, false, nullptr);
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 ::PROTOBUF_NAMESPACE_ID::internal::ExtensionIdentifier< ::PROTOBUF_NAMESPACE_ID::FieldOptions,
+    ::PROTOBUF_NAMESPACE_ID::internal::PrimitiveTypeTraits< bool >, 8, false>
+  is_indexed(kIsIndexedFieldNumber, false, nullptr);
 
 // @@protoc_insertion_point(namespace_scope)
 }  // namespace aelf
+PROTOBUF_NAMESPACE_OPEN
+PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -16,20 +16,29 @@
  *
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <cstdio>
+#include <functional>
 #include <map>
+#include <set>
 #include <sstream>
+#include <thread>
 #include <vector>
 #include <google/protobuf/stubs/logging.h>
+#include <google/protobuf/wire_format.h>
 
 #include "contract_csharp_generator.h"
 #include "contract_csharp_generator_helpers.h"
-#include "aelf_options.pb.h"
+#include "contract_csharp_model.h"
 
 using google::protobuf::compiler::csharp::GetClassName;
 using google::protobuf::compiler::csharp::GetFileNamespace;
 using google::protobuf::compiler::csharp::GetReflectionClassName;
 using google::protobuf::compiler::csharp::GetPropertyName;
+using google::protobuf::internal::WireFormat;
+using google::protobuf::internal::WireFormatLite;
 using grpc::protobuf::Descriptor;
 using grpc::protobuf::FileDescriptor;
 using grpc::protobuf::MethodDescriptor;
@@ -46,8 +55,7 @@ using grpc_generator::MethodType;
 using grpc_generator::StringReplace;
 using std::map;
 using std::vector;
-using Services = std::vector<const ServiceDescriptor*>;
-using Methods = std::vector<const MethodDescriptor*>;
+using Methods = std::vector<const grpc_contract_csharp_generator::MethodModel*>;
 
 namespace grpc_contract_csharp_generator {
 namespace {
@@ -128,116 +136,74 @@ std::string GetStubClassName(const ServiceDescriptor *service) {
   return service->name()+"Stub";
 }
 
-std::string GetReferenceClassName(const ServiceDescriptor* service) {
-  return service->name()+"ReferenceState";
-}
-
-bool IsEventMessageType(const Descriptor* message){
-  return message->options().GetExtension(aelf::is_event);
+std::string GetStubBatchClassName(const ServiceDescriptor *service) {
+  return service->name()+"StubBatch";
 }
 
-bool IsIndexedField(const FieldDescriptor* field){
-  return field->options().GetExtension(aelf::is_indexed);
+std::string GetReferenceClassName(const ServiceDescriptor* service) {
+  return service->name()+"ReferenceState";
 }
 
-bool IsViewOnlyMethod(const MethodDescriptor* method) {
-  return method->options().GetExtension(aelf::is_view);
+std::string GetBenchmarkClassName(const ServiceDescriptor* service) {
+  return service->name()+"Benchmarks";
 }
 
-
-int GetServiceBaseCount(const ServiceDescriptor* service){
-  return service->options().ExtensionSize(aelf::base);
+std::string GetReplayClassName(const ServiceDescriptor* service) {
+  return service->name()+"Replay";
 }
 
-std::string GetServiceBase(const ServiceDescriptor* service, int index){
-  return service->options().GetExtension(aelf::base, index);
+std::string GetDirectStubClassName(const ServiceDescriptor* service) {
+  return service->name()+"DirectStub";
 }
 
-void DepthFirstSearch(const ServiceDescriptor* service,
-                      std::vector<const ServiceDescriptor*>* list,
-                      std::set<const ServiceDescriptor*>* seen) {
-  if (!seen->insert(service).second) {
+void DepthFirstSearchForFile(const FileDescriptor* file,
+                             std::vector<const FileDescriptor*>* list,
+                             std::set<const FileDescriptor*>* seen) {
+  if (!seen->insert(file).second) {
     return;
   }
 
-  const FileDescriptor* file = service->file();
   // Add all dependencies.
   for (int i = 0; i < file->dependency_count(); i++) {
-    if(file->dependency(i)->service_count() == 0){
-      continue;
-    }
-    if(file->dependency(i)->service_count() > 1){
-      GOOGLE_LOG(ERROR) << file->dependency(i)->name() << ": File contains more than one service.";
-    }
-    DepthFirstSearch(file->dependency(i)->service(0), list, seen);
+    DepthFirstSearchForFile(file->dependency(i), list, seen);
   }
 
   // Add this file.
-  list->push_back(service);
+  list->push_back(file);
 }
 
-void DepthFirstSearchForBase(const ServiceDescriptor* service,
-                             std::vector<std::string>* list,
-                             std::set<std::string>* seen,
-                             std::map<std::string, const ServiceDescriptor*> all_services
-) {
-  if (!seen->insert(service->file()->name()).second) {
-    return;
-  }
-
-  int baseCount = GetServiceBaseCount(service);
-//  const FileDescriptor* file = service->file();
-  // Add all dependencies.
-  for (int i = 0; i < baseCount; i++) {
-    std::string baseName = GetServiceBase(service, i);
-    if(!all_services.count(baseName)){
-      GOOGLE_LOG(ERROR) << "Can't find specified base " << baseName << ", did you forget to import it?";
-    }
-    const ServiceDescriptor* baseService = all_services[baseName];
-    DepthFirstSearchForBase(baseService, list, seen, all_services);
+// Gets all files needed to rebuild the descriptors of the flattened service,
+// dependencies first.
+std::vector<const FileDescriptor*> GetEmbeddedFiles(const FileModel& model,
+                                                    const ServiceModel& service){
+  std::vector<const FileDescriptor*> files;
+  std::set<const FileDescriptor*> seen;
+  for(int i = 0; i < service.full_service_count; i++){
+    DepthFirstSearchForFile(GetFullService(model, service, i).descriptor->file(), &files, &seen);
   }
-
-  // Add this file.
-  list->push_back(service->file()->name());
+  return files;
 }
 
-Services GetFullService(const ServiceDescriptor* service){
-  Services all_depended_services;
-  std::set<const ServiceDescriptor*> seen;
-  DepthFirstSearch(service, &all_depended_services, &seen);
-  std::map<std::string, const ServiceDescriptor*> services;
-  for(Services::iterator itr = all_depended_services.begin(); itr != all_depended_services.end(); ++itr){
-    services[(*itr)->file()->name()]= *itr;
-  }
-  Services result;
-  std::vector<std::string> bases;
-  std::set<std::string> seenBases;
-  DepthFirstSearchForBase(service, &bases, &seenBases, services);
-  for(std::vector<std::string>::iterator itr = bases.begin(); itr != bases.end(); ++itr){
-    result.push_back(services[*itr]);
-  }
-  return result;
-}
+typedef std::map<const FileDescriptor*, int> FileIndex;
 
-Methods GetFullMethod(const ServiceDescriptor* service){
-  Services services = GetFullService(service);
-  Methods methods;
-  for(Services::iterator itr = services.begin(); itr != services.end(); ++itr){
-    for(int i = 0; i < (*itr)->method_count(); i++){
-      methods.push_back((*itr)->method(i));
-    }
+// Positions of the embedded files, looked up once per service instead of
+// once per descriptor expression.
+FileIndex GetEmbeddedFileIndex(const FileModel& model, const ServiceModel& service) {
+  std::vector<const FileDescriptor*> files = GetEmbeddedFiles(model, service);
+  FileIndex index;
+  for (size_t i = 0; i < files.size(); i++) {
+    index[files[i]] = static_cast<int>(i);
   }
-  return methods;
+  return index;
 }
 
-std::string GetCSharpMethodType(const MethodDescriptor* method) {
-  if(IsViewOnlyMethod(method)) {
+std::string GetCSharpMethodType(const MethodModel& method) {
+  if(method.is_view) {
     return "aelf::MethodType.View";
   }
   return "aelf::MethodType.Action";
 }
 std::string GetServiceNameFieldName() { return "__ServiceName"; }
-std::string GetStateTypeName(const ServiceDescriptor* service) { return service->options().GetExtension(aelf::csharp_state); }
 
 std::string GetMarshallerFieldName(const Descriptor* message) {
   return "__Marshaller_" +
@@ -248,41 +214,180 @@ std::string GetMethodFieldName(const MethodDescriptor* method) {
   return "__Method_" + method->name();
 }
 
-std::string GetAccessLevel(char flags) {
+std::string GetAccessLevel(unsigned int flags) {
   return flags & INTERNAL_ACCESS ? "internal" : "public";
 }
 
-bool NeedEvent(char flags) {
+bool NeedEvent(unsigned int flags) {
   return flags & GENERATE_EVENT;
 }
 
-bool NeedContract(char flags) {
+bool NeedEmbeddedDescriptor(unsigned int flags) {
+  return flags & EMBEDDED_DESCRIPTOR;
+}
+
+bool NeedEventBloom(unsigned int flags) {
+  return flags & GENERATE_EVENT_BLOOM;
+}
+
+bool NeedEventDecoder(unsigned int flags) {
+  return flags & GENERATE_EVENT_DECODER;
+}
+
+bool NeedEventBatch(unsigned int flags) {
+  return flags & GENERATE_EVENT_BATCH;
+}
+
+bool NeedEventRouter(unsigned int flags) {
+  return flags & GENERATE_EVENT_ROUTER;
+}
+
+bool NeedContract(unsigned int flags) {
   return flags & GENERATE_CONTRACT;
 }
 
-bool NeedStub(char flags) {
+bool NeedStub(unsigned int flags) {
   return flags & GENERATE_STUB;
 }
 
-bool NeedReference(char flags) {
+bool NeedStubBatch(unsigned int flags) {
+  return NeedStub(flags) && (flags & GENERATE_STUB_BATCH);
+}
+
+bool NeedExecuteBatch(unsigned int flags) {
+  return NeedContract(flags) && (flags & GENERATE_STUB_BATCH);
+}
+
+bool NeedStubValueTask(unsigned int flags) {
+  return NeedStub(flags) && (flags & GENERATE_STUB_VALUE_TASK);
+}
+
+bool NeedBenchmark(unsigned int flags) {
+  return NeedContract(flags) && (flags & GENERATE_BENCHMARK);
+}
+
+bool NeedReplay(unsigned int flags) {
+  return NeedContract(flags) && (flags & GENERATE_REPLAY);
+}
+
+bool NeedInstrument(unsigned int flags) {
+  return NeedContract(flags) && (flags & INSTRUMENT_CONTRACT);
+}
+
+// The direct stub calls the contract base, so it's only generated along
+// with the contract.
+bool NeedDirectStub(unsigned int flags) {
+  return NeedContract(flags) && (flags & GENERATE_DIRECT_STUB);
+}
+
+bool NeedPoolInput(unsigned int flags) {
+  return NeedContract(flags) && (flags & POOL_CONTRACT_INPUT);
+}
+
+bool NeedChunkedInput(unsigned int flags) {
+  return NeedContract(flags) && (flags & CHUNKED_STREAM_INPUT);
+}
+
+bool NeedStubTransactionTemplate(unsigned int flags) {
+  return NeedStub(flags) && (flags & GENERATE_STUB_TX_TEMPLATE);
+}
+
+bool NeedReference(unsigned int flags) {
   return flags & GENERATE_REFERENCE;
 }
 
-bool NeedContainer(char flags){
-  return NeedContract(flags) | NeedStub(flags) | NeedReference(flags);
+bool NeedReferenceViewMemo(unsigned int flags) {
+  return NeedReference(flags) && (flags & GENERATE_REFERENCE_VIEW_MEMO);
+}
+
+bool NeedReferenceLocal(unsigned int flags) {
+  return NeedReference(flags) && (flags & GENERATE_REFERENCE_LOCAL);
+}
+
+// The contract side gets the same interface along with an adapter over the
+// contract base, for the host to register.
+bool NeedLocalInterface(unsigned int flags) {
+  return (NeedReference(flags) || NeedContract(flags)) && (flags & GENERATE_REFERENCE_LOCAL);
+}
+
+bool NeedLazyInit(unsigned int flags) {
+  return flags & LAZY_STATIC_INIT;
+}
+
+bool NeedReuseBase(unsigned int flags) {
+  return flags & REUSE_BASE_CONTAINER;
+}
+
+// Base containers are still needed with nocontract when their method fields
+// are reused by derived containers.
+bool NeedContainer(unsigned int flags){
+  return NeedContract(flags) | NeedStub(flags) | NeedReference(flags) | NeedReuseBase(flags);
 }
 
-bool NeedOnlyEvent(char flags){
-  return NeedEvent(flags) & !NeedContract(flags) & !NeedReference(flags) & !NeedStub(flags);
+bool NeedOnlyEvent(unsigned int flags){
+  return NeedEvent(flags) & !NeedContainer(flags);
 }
 
-std::string GetMethodRequestParamServer(const MethodDescriptor* method) {
+std::string GetQualifiedContainerClassName(const ServiceDescriptor* service) {
+  grpc::string file_namespace = GetFileNamespace(service->file());
+  if (file_namespace.empty()) {
+    return "global::" + GetServiceContainerClassName(service);
+  }
+  return "global::" + file_namespace + "." + GetServiceContainerClassName(service);
+}
+
+// Inherited methods are declared by the container of their own service when
+// base containers are reused.
+bool IsReusedMethod(const ServiceModel& service, const MethodModel& method,
+                    unsigned int flags) {
+  return NeedReuseBase(flags) && method.service != service.index;
+}
+
+// Gets the expression of the static holder instance when initialization is
+// lazy, or of the static field otherwise.
+std::string GetStaticInstance(const std::string& name, unsigned int flags) {
+  return NeedLazyInit(flags) ? name + ".Instance" : name;
+}
+
+std::string GetMethodFieldReference(const ServiceModel& service,
+                                    const MethodModel& method,
+                                    unsigned int flags) {
+  if (IsReusedMethod(service, method, flags)) {
+    return GetQualifiedContainerClassName(method.descriptor->service()) + "." +
+           GetStaticInstance(GetMethodFieldName(method.descriptor), flags);
+  }
+  return GetStaticInstance(GetMethodFieldName(method.descriptor), flags);
+}
+
+// Gets the methods whose fields are declared by the container of service.
+Methods GetContainerMethods(const FileModel& model, const ServiceModel& service,
+                            unsigned int flags) {
+  Methods result;
+  for (int i = 0; i < service.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service, i);
+    if (!IsReusedMethod(service, method, flags)) {
+      result.push_back(&method);
+    }
+  }
+  return result;
+}
+
+bool IsChunkedMethod(const MethodDescriptor* method) {
+  return GetMethodType(method) == METHODTYPE_CLIENT_STREAMING ||
+         GetMethodType(method) == METHODTYPE_BIDI_STREAMING;
+}
+
+std::string GetMethodRequestParamServer(const MethodDescriptor* method,
+                                        unsigned int flags) {
   switch (GetMethodType(method)) {
     case METHODTYPE_NO_STREAMING:
     case METHODTYPE_SERVER_STREAMING:
       return GetClassName(method->input_type()) + " input";
     case METHODTYPE_CLIENT_STREAMING:
     case METHODTYPE_BIDI_STREAMING:
+      if (NeedChunkedInput(flags)) {
+        return "ChunkedInput<" + GetClassName(method->input_type()) + "> input";
+      }
       return "grpc::IAsyncStreamReader<" + GetClassName(method->input_type()) +
              "> requestStream";
   }
@@ -294,13 +399,19 @@ std::string GetMethodReturnTypeServer(const MethodDescriptor* method) {
   return GetClassName(method->output_type());
 }
 
-std::string GetMethodResponseStreamMaybe(const MethodDescriptor* method) {
+// A contract returns a single output, so response streams are dropped along
+// with chunked inputs.
+std::string GetMethodResponseStreamMaybe(const MethodDescriptor* method,
+                                         unsigned int flags) {
   switch (GetMethodType(method)) {
     case METHODTYPE_NO_STREAMING:
     case METHODTYPE_CLIENT_STREAMING:
       return "";
     case METHODTYPE_SERVER_STREAMING:
     case METHODTYPE_BIDI_STREAMING:
+      if (NeedChunkedInput(flags)) {
+        return "";
+      }
       return ", grpc::IServerStreamWriter<" +
              GetClassName(method->output_type()) + "> responseStream";
   }
@@ -310,13 +421,13 @@ std::string GetMethodResponseStreamMaybe(const MethodDescriptor* method) {
 
 // Gets vector of all messages used as input or output types.
 std::vector<const Descriptor*> GetUsedMessages(
-    const ServiceDescriptor* service) {
+    const FileModel& model, const ServiceModel& service, unsigned int flags) {
   std::set<const Descriptor*> descriptor_set;
   std::vector<const Descriptor*>
       result;  // vector is to maintain stable ordering
-  Methods methods = GetFullMethod(service);
+  Methods methods = GetContainerMethods(model, service, flags);
   for (Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-    const MethodDescriptor* method = *itr;
+    const MethodDescriptor* method = (*itr)->descriptor;
     if (descriptor_set.find(method->input_type()) == descriptor_set.end()) {
       descriptor_set.insert(method->input_type());
       result.push_back(method->input_type());
@@ -329,62 +440,237 @@ std::vector<const Descriptor*> GetUsedMessages(
   return result;
 }
 
-void GenerateMarshallerFields(Printer* out, const ServiceDescriptor* service) {
+// Gets vector of all messages used as input or output types by any service of
+// the file.
+std::vector<const Descriptor*> GetUsedMessages(const FileModel& model,
+                                              unsigned int flags) {
+  std::set<const Descriptor*> descriptor_set;
+  std::vector<const Descriptor*> result;
+  for (int i = 0; i < model.file_service_count; i++) {
+    std::vector<const Descriptor*> used_messages =
+        GetUsedMessages(model, GetFileService(model, i), flags);
+    for (size_t j = 0; j < used_messages.size(); j++) {
+      if (descriptor_set.insert(used_messages[j]).second) {
+        result.push_back(used_messages[j]);
+      }
+    }
+  }
+  return result;
+}
+
+// Files declaring more than one service share one marshaller class, so that
+// the marshallers aren't repeated in every container.
+bool NeedSharedMarshallers(const FileDescriptor* file) {
+  return file->service_count() > 1;
+}
+
+std::string GetSharedMarshallersClassName(const FileDescriptor* file) {
+  return grpc_generator::FileNameInUpperCamel(file, false) + "Marshallers";
+}
+
+std::string GetMarshallerReference(const ServiceDescriptor* service,
+                                   const Descriptor* message,
+                                   unsigned int flags) {
+  std::string reference = GetStaticInstance(GetMarshallerFieldName(message), flags);
+  if (NeedSharedMarshallers(service->file())) {
+    return GetSharedMarshallersClassName(service->file()) + "." + reference;
+  }
+  return reference;
+}
+
+// With lazy initialization every marshaller and method lives in its own
+// holder class, so only the ones actually used get initialized.
+void GenerateLazyHolderClassBegin(Printer* out, const std::string& name,
+                                  const std::string& modifier) {
+  out->Print("$modifier$static class $name$\n",
+             "modifier", modifier, "name", name);
+  out->Print("{\n");
+  out->Indent();
+}
+
+void GenerateLazyHolderClassEnd(Printer* out) {
+  out->Outdent();
+  out->Print("}\n");
+}
+
+void GenerateMarshallerField(Printer* out, const Descriptor* message,
+                             const std::string& modifier, unsigned int flags) {
+  std::string fieldname = GetMarshallerFieldName(message);
+  std::string fieldmodifier = modifier;
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassBegin(out, fieldname, modifier);
+    fieldname = "Instance";
+    fieldmodifier = "internal ";
+  }
+  out->Print(
+      "$modifier$static readonly aelf::Marshaller<$type$> $fieldname$ = "
+      "aelf::Marshallers.Create((arg) => "
+      "global::Google.Protobuf.MessageExtensions.ToByteArray(arg), "
+      "$type$.Parser.ParseFrom);\n",
+      "modifier", fieldmodifier,
+      "fieldname", fieldname, "type",
+      GetClassName(message));
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassEnd(out);
+  }
+}
+
+void GenerateMarshallerFields(Printer* out, const FileModel& model,
+                              const ServiceModel& service, unsigned int flags) {
+  if (NeedSharedMarshallers(model.file)) {
+    return;
+  }
   out->Print("#region Marshallers\n");
-  std::vector<const Descriptor*> used_messages = GetUsedMessages(service);
+  std::vector<const Descriptor*> used_messages = GetUsedMessages(model, service, flags);
   for (size_t i = 0; i < used_messages.size(); i++) {
-    const Descriptor* message = used_messages[i];
-    out->Print(
-        "static readonly aelf::Marshaller<$type$> $fieldname$ = "
-        "aelf::Marshallers.Create((arg) => "
-        "global::Google.Protobuf.MessageExtensions.ToByteArray(arg), "
-        "$type$.Parser.ParseFrom);\n",
-        "fieldname", GetMarshallerFieldName(message), "type",
-        GetClassName(message));
+    GenerateMarshallerField(out, used_messages[i], "", flags);
   }
   out->Print("#endregion\n");
   out->Print("\n");
 }
 
-void GenerateStaticMethodField(Printer* out, const MethodDescriptor* method) {
+void GenerateSharedMarshallersClass(Printer* out, const FileModel& model,
+                                    unsigned int flags) {
+  out->Print("internal static class $classname$\n",
+             "classname", GetSharedMarshallersClassName(model.file));
+  out->Print("{\n");
+  out->Indent();
+  std::vector<const Descriptor*> used_messages = GetUsedMessages(model, flags);
+  for (size_t i = 0; i < used_messages.size(); i++) {
+    GenerateMarshallerField(out, used_messages[i], "internal ", flags);
+  }
+  out->Outdent();
+  out->Print("}\n\n");
+}
+
+void GenerateStaticMethodField(Printer* out, const ServiceModel& service,
+                               const MethodModel& method_model, unsigned int flags) {
+  const MethodDescriptor* method = method_model.descriptor;
+  // Reused fields are accessed from the containers of derived services.
+  std::string modifier = NeedReuseBase(flags) ? "internal " : "";
+  std::string fieldname = GetMethodFieldName(method);
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassBegin(out, fieldname, modifier);
+    modifier = "internal ";
+    fieldname = "Instance";
+  }
   out->Print(
-      "static readonly aelf::Method<$request$, $response$> $fieldname$ = new "
+      "$modifier$static readonly aelf::Method<$request$, $response$> $fieldname$ = new "
       "aelf::Method<$request$, $response$>(\n",
-      "fieldname", GetMethodFieldName(method), "request",
+      "modifier", modifier,
+      "fieldname", fieldname, "request",
       GetClassName(method->input_type()), "response",
       GetClassName(method->output_type()));
   out->Indent();
   out->Indent();
   out->Print("$methodtype$,\n", "methodtype",
-             GetCSharpMethodType(method));
+             GetCSharpMethodType(method_model));
   out->Print("$servicenamefield$,\n", "servicenamefield",
              GetServiceNameFieldName());
   out->Print("\"$methodname$\",\n", "methodname", method->name());
   out->Print("$requestmarshaller$,\n", "requestmarshaller",
-             GetMarshallerFieldName(method->input_type()));
+             GetMarshallerReference(service.descriptor, method->input_type(), flags));
   out->Print("$responsemarshaller$);\n", "responsemarshaller",
-             GetMarshallerFieldName(method->output_type()));
-  out->Print("\n");
+             GetMarshallerReference(service.descriptor, method->output_type(), flags));
+  out->Outdent();
   out->Outdent();
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassEnd(out);
+  }
+  out->Print("\n");
+}
+
+// Embeds the serialized FileDescriptorSet of the flattened service so that
+// descriptors can be built without initializing any reflection class.
+void GenerateEmbeddedDescriptorData(Printer* out, const FileModel& model,
+                                    const ServiceModel& service) {
+  grpc::protobuf::FileDescriptorSet descriptor_set;
+  std::vector<const FileDescriptor*> files = GetEmbeddedFiles(model, service);
+  for (size_t i = 0; i < files.size(); i++) {
+    files[i]->CopyTo(descriptor_set.add_file());
+  }
+  grpc::string data;
+  descriptor_set.SerializeToString(&data);
+
+  out->Print("static global::System.ReadOnlySpan<byte> __DescriptorData => new byte[]\n");
+  out->Print("{\n");
+  out->Indent();
+  for (size_t i = 0; i < data.size(); i += 16) {
+    grpc::string line;
+    for (size_t j = i; j < data.size() && j < i + 16; j++) {
+      char hex[8];
+      snprintf(hex, sizeof(hex), "0x%02X, ", static_cast<unsigned char>(data[j]));
+      line += hex;
+    }
+    line.resize(line.size() - 1);
+    out->Print("$line$\n", "line", line);
+  }
   out->Outdent();
+  out->Print("};\n");
+  out->Print("\n");
+
+  out->Print(
+      "static readonly global::System.Lazy<global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor>> __FileDescriptors =\n"
+      "    new global::System.Lazy<global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor>>(BuildFileDescriptors);\n");
+  out->Print("\n");
+  out->Print(
+      "static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor> BuildFileDescriptors()\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var input = new global::Google.Protobuf.CodedInputStream(__DescriptorData.ToArray());\n");
+    out->Print("var data = new global::System.Collections.Generic.List<global::Google.Protobuf.ByteString>();\n");
+    out->Print("while (input.ReadTag() != 0)\n");
+    out->Print("{\n");
+    out->Print("  data.Add(input.ReadBytes());\n");
+    out->Print("}\n");
+    out->Print("return global::Google.Protobuf.Reflection.FileDescriptor.BuildFromByteStrings(data);\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
 }
 
-void GenerateServiceDescriptorProperty(Printer* out,
-                                       const ServiceDescriptor* service) {
-  std::ostringstream index;
-  index << service->index();
+// Gets the expression of the descriptor of svc, either from the reflection
+// class of its file or from the embedded descriptor data.
+std::string GetServiceDescriptorExpression(const FileIndex& embedded_files,
+                                           const ServiceDescriptor* svc,
+                                           unsigned int flags) {
+  std::ostringstream expression;
+  if (NeedEmbeddedDescriptor(flags)) {
+    FileIndex::const_iterator found = embedded_files.find(svc->file());
+    GOOGLE_CHECK(found != embedded_files.end());
+    expression << "__FileDescriptors.Value[" << found->second << "]";
+  } else {
+    expression << GetReflectionClassName(svc->file()) << ".Descriptor";
+  }
+  expression << ".Services[" << svc->index() << "]";
+  return expression.str();
+}
+
+void GenerateServiceDescriptorProperty(Printer* out, const FileModel& model,
+                                       const ServiceModel& service,
+                                       unsigned int flags) {
   out->Print(
       "public static global::Google.Protobuf.Reflection.ServiceDescriptor "
       "Descriptor\n");
+  FileIndex embedded_files;
+  if (NeedEmbeddedDescriptor(flags)) {
+    embedded_files = GetEmbeddedFileIndex(model, service);
+  }
   out->Print("{\n");
-  out->Print("  get { return $umbrella$.Descriptor.Services[$index$]; }\n",
-             "umbrella", GetReflectionClassName(service->file()), "index",
-             index.str());
+  out->Print("  get { return $descriptor$; }\n",
+             "descriptor", GetServiceDescriptorExpression(embedded_files, service.descriptor, flags));
   out->Print("}\n");
 }
 
-void GenerateAllServiceDescriptorsProperty(Printer* out,
-                                           const ServiceDescriptor* service) {
+void GenerateAllServiceDescriptorsProperty(Printer* out, const FileModel& model,
+                                           const ServiceModel& service,
+                                           unsigned int flags) {
+  FileIndex embedded_files;
+  if (NeedEmbeddedDescriptor(flags)) {
+    embedded_files = GetEmbeddedFileIndex(model, service);
+  }
   out->Print(
       "public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors\n"
   );
@@ -399,14 +685,10 @@ void GenerateAllServiceDescriptorsProperty(Printer* out,
       out->Print("{\n");
       {
         out->Indent();
-        Services services = GetFullService(service);
-        for(Services::iterator itr = services.begin(); itr != services.end(); ++itr){
-          const ServiceDescriptor* svc = *itr;
-          std::ostringstream index;
-          index << svc->index();
-          out->Print("$umbrella$.Descriptor.Services[$index$],\n",
-                     "umbrella", GetReflectionClassName(svc->file()), "index",
-                     index.str());
+        for(int i = 0; i < service.full_service_count; i++){
+          const ServiceDescriptor* svc = GetFullService(model, service, i).descriptor;
+          out->Print("$descriptor$,\n",
+                     "descriptor", GetServiceDescriptorExpression(embedded_files, svc, flags));
         }
         out->Outdent();
       }
@@ -419,135 +701,2229 @@ void GenerateAllServiceDescriptorsProperty(Printer* out,
   out->Print("}\n");
 }
 
-void GenerateContractBaseClass(Printer *out, const ServiceDescriptor *service) {
-  
-  out->Print(
-      "/// <summary>Base class for the contract of "
-      "$servicename$</summary>\n",
-      "servicename", GetServiceClassName(service));
-  out->Print("public abstract partial class $name$ : "
-             "AElf.Sdk.CSharp.CSharpSmartContract<$statetype$>\n",
-             "name", GetServerClassName(service),
-             "statetype", GetStateTypeName(service));
-  out->Print("{\n");
-  out->Indent();
-  Methods methods = GetFullMethod(service);
-  for (Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-    const MethodDescriptor* method = *itr;
-    out->Print(
-        "public abstract $returntype$ "
-        "$methodname$($request$$response_stream_maybe$);\n",
-        "methodname", method->name(),
-        "returntype", GetMethodReturnTypeServer(method),
-        "request", GetMethodRequestParamServer(method),
-        "response_stream_maybe", GetMethodResponseStreamMaybe(method));
+bool HasMethodFee(const FileModel& model, const ServiceModel& service) {
+  for (int i = 0; i < service.full_method_count; i++) {
+    if (GetFullMethod(model, service, i).has_fee) {
+      return true;
+    }
   }
-  out->Outdent();
-  out->Print("}\n");
-  out->Print("\n");
+  return false;
 }
 
-void GenerateBindServiceMethod(Printer* out, const ServiceDescriptor* service) {
+// The fee options of the flattened service, keyed by method name, so that
+// costs can be checked before the contract is called. Methods without fee
+// options are left out.
+void GenerateMethodFeeTable(Printer* out, const FileModel& model,
+                            const ServiceModel& service, unsigned int flags) {
+  std::string type = "(long BaseFee, (string Symbol, long Weight)[] ResourceWeights)";
+  std::string dictionary = "global::System.Collections.Generic.IReadOnlyDictionary<string, " + type + ">";
+  // The table is exposed through the same property either way; lazy_init only
+  // moves the backing field into a holder class.
+  std::string fieldname = "__MethodFees";
+  std::string modifier = "";
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassBegin(out, fieldname, modifier);
+    fieldname = "Instance";
+    modifier = "internal ";
+  }
   out->Print(
-      "public static aelf::ServerServiceDefinition BindService($implclass$ "
-      "serviceImpl)\n",
-      "implclass", GetServerClassName(service));
-  out->Print("{\n");
+      "$modifier$static readonly $dictionary$ $fieldname$ =\n",
+      "modifier", modifier, "dictionary", dictionary, "fieldname", fieldname);
   out->Indent();
-
-  out->Print("return aelf::ServerServiceDefinition.CreateBuilder()");
   out->Indent();
+  out->Print("new global::System.Collections.Generic.Dictionary<string, $type$>\n",
+             "type", type);
+  out->Print("{\n");
   out->Indent();
-  out->Print("\n.AddDescriptors(Descriptors)");
-  Methods methods = GetFullMethod(service);
-  for (Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-    const MethodDescriptor* method = *itr;
-    out->Print("\n.AddMethod($methodfield$, serviceImpl.$methodname$)",
-               "methodfield", GetMethodFieldName(method), "methodname",
-               method->name());
+  for (int i = 0; i < service.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service, i);
+    if (!method.has_fee) {
+      continue;
+    }
+    std::ostringstream weights;
+    for (int j = 0; j < method.resource_weight_count; j++) {
+      const ResourceWeightModel& weight = GetResourceWeight(model, method, j);
+      weights << (j == 0 ? " " : ", ") << "(\"" << weight.symbol << "\", "
+              << weight.weight << ")";
+    }
+    std::ostringstream basefee;
+    basefee << method.base_fee;
+    out->Print("{ \"$methodname$\", ($basefee$, new (string Symbol, long Weight)[] {$weights$ }) },\n",
+               "methodname", method.descriptor->name(),
+               "basefee", basefee.str(),
+               "weights", weights.str());
   }
-  out->Print(".Build();\n");
   out->Outdent();
+  out->Print("};\n");
   out->Outdent();
-
   out->Outdent();
-  out->Print("}\n");
-  out->Print("\n");
+  if (NeedLazyInit(flags)) {
+    GenerateLazyHolderClassEnd(out);
+  }
+  out->Print("public static $dictionary$ MethodFees => __MethodFees$instance$;\n",
+             "dictionary", dictionary, "instance", NeedLazyInit(flags) ? ".Instance" : "");
 }
 
-void GenerateStubClass(Printer *out, const ServiceDescriptor *service) {
-  out->Print("public class $stubname$ : aelf::ContractStubBase\n",
-             "stubname", GetStubClassName(service));
+bool HasChunkedMethod(const FileModel& model, const ServiceModel& service) {
+  for (int i = 0; i < service.full_method_count; i++) {
+    if (IsChunkedMethod(GetFullMethod(model, service, i).descriptor)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Streaming inputs are sent as length-delimited messages one after another.
+// ChunkedInput parses them one at a time while being enumerated, so the
+// contract never holds more than one of them at once.
+void GenerateChunkedInput(Printer* out) {
+  out->Print("#region Chunked Input\n");
+  out->Print("public sealed class ChunkedInput<T> : global::System.Collections.Generic.IEnumerable<T>\n");
+  out->Print("    where T : global::Google.Protobuf.IMessage<T>\n");
   out->Print("{\n");
   {
     out->Indent();
-    Methods methods = GetFullMethod(service);
-    for (Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-      const MethodDescriptor* method = *itr;
-      out->Print(
-          "public aelf::IMethodStub<$request$, $response$> $fieldname$\n",
-          "fieldname", method->name(),
-          "request", GetClassName(method->input_type()),
-          "response", GetClassName(method->output_type()));
+    out->Print("readonly byte[] __data;\n");
+    out->Print("readonly global::Google.Protobuf.MessageParser<T> __parser;\n");
+    out->Print("\n");
+    out->Print("public ChunkedInput(byte[] data, global::Google.Protobuf.MessageParser<T> parser)\n");
+    out->Print("{\n");
+    out->Print("  __data = data;\n");
+    out->Print("  __parser = parser;\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public static ChunkedInput<T> FromChunks(global::System.Collections.Generic.IEnumerable<T> chunks, global::Google.Protobuf.MessageParser<T> parser)\n");
+    out->Print("{\n");
+    out->Print("  var stream = new global::System.IO.MemoryStream();\n");
+    out->Print("  foreach (var chunk in chunks)\n");
+    out->Print("  {\n");
+    out->Print("    global::Google.Protobuf.MessageExtensions.WriteDelimitedTo(chunk, stream);\n");
+    out->Print("  }\n");
+    out->Print("  return new ChunkedInput<T>(stream.ToArray(), parser);\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public byte[] ToByteArray()\n");
+    out->Print("{\n");
+    out->Print("  return __data;\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public global::System.Collections.Generic.IEnumerator<T> GetEnumerator()\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var offset = 0;\n");
+      out->Print("while (offset < __data.Length)\n");
       out->Print("{\n");
       {
         out->Indent();
-        out->Print("get { return __factory.Create($fieldname$); }\n",
-                   "fieldname", GetMethodFieldName(method));
+        out->Print("var length = 0;\n");
+        out->Print("for (var shift = 0; ; shift += 7)\n");
+        out->Print("{\n");
+        out->Print("  if (offset == __data.Length || shift > 28)\n");
+        out->Print("  {\n");
+        out->Print("    throw new global::System.FormatException(\"Malformed chunked input.\");\n");
+        out->Print("  }\n");
+        out->Print("  var b = __data[offset++];\n");
+        out->Print("  length |= (b & 0x7F) << shift;\n");
+        out->Print("  if (b < 0x80)\n");
+        out->Print("  {\n");
+        out->Print("    break;\n");
+        out->Print("  }\n");
+        out->Print("}\n");
+        out->Print("if (length < 0 || length > __data.Length - offset)\n");
+        out->Print("{\n");
+        out->Print("  throw new global::System.FormatException(\"Malformed chunked input.\");\n");
+        out->Print("}\n");
+        out->Print("var chunk = __parser.ParseFrom(__data, offset, length);\n");
+        out->Print("offset += length;\n");
+        out->Print("yield return chunk;\n");
         out->Outdent();
       }
-      out->Print("}\n\n");
+      out->Print("}\n");
+      out->Outdent();
     }
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("global::System.Collections.IEnumerator global::System.Collections.IEnumerable.GetEnumerator()\n");
+    out->Print("{\n");
+    out->Print("  return GetEnumerator();\n");
+    out->Print("}\n");
     out->Outdent();
   }
-
   out->Print("}\n");
+  out->Print("\n");
+  out->Print("static aelf::Method<ChunkedInput<TInput>, TOutput> __Chunked<TInput, TOutput>(aelf::Method<TInput, TOutput> method, global::Google.Protobuf.MessageParser<TInput> parser)\n");
+  out->Print("    where TInput : global::Google.Protobuf.IMessage<TInput>\n");
+  out->Print("{\n");
+  out->Print("  return new aelf::Method<ChunkedInput<TInput>, TOutput>(method.Type, method.ServiceName, method.Name,\n");
+  out->Print("      aelf::Marshallers.Create((ChunkedInput<TInput> input) => input.ToByteArray(), bytes => new ChunkedInput<TInput>(bytes, parser)),\n");
+  out->Print("      method.ResponseMarshaller);\n");
+  out->Print("}\n");
+  out->Print("#endregion\n");
+  out->Print("\n");
 }
 
+// Inputs are only pooled when they can be reset field by field: oneofs keep a
+// case that can't be reset through the properties, and proto2 fields track
+// presence.
+bool IsPoolableInput(const Descriptor* message) {
+  if (message->file()->syntax() != FileDescriptor::SYNTAX_PROTO3) {
+    return false;
+  }
+  for (int i = 0; i < message->field_count(); i++) {
+    if (message->field(i)->containing_oneof() != NULL) {
+      return false;
+    }
+  }
+  return true;
+}
 
-  void GenerateReferenceClass(Printer* out, const ServiceDescriptor* service, char flags) {
+// Only methods marked with aelf.pool_input are pooled, as they promise not to
+// keep their input.
+bool IsPooledMethod(const MethodModel& method) {
+  return method.pool_input &&
+         GetMethodType(method.descriptor) == METHODTYPE_NO_STREAMING &&
+         IsPoolableInput(method.descriptor->input_type());
+}
 
-    // TODO: Maybe provide ContractReferenceState in options
-    out->Print("public class $classname$ : global::AElf.Sdk.CSharp.State.ContractReferenceState\n",
-               "classname", GetReferenceClassName(service));
-    out->Print("{\n");
-    {
-      out->Indent();
-      Methods methods = GetFullMethod(service);
-      for (Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-        const MethodDescriptor* method = *itr;
-        out->Print("$access_level$ global::AElf.Sdk.CSharp.State.MethodReference<$request$, $response$> $fieldname$ { get; set; }\n",
-                   "access_level", GetAccessLevel(flags),
-                   "fieldname", method->name(),
-                   "request", GetClassName(method->input_type()),
-                   "response", GetClassName(method->output_type()));
-      }
-      out->Outdent();
+std::vector<const Descriptor*> GetPooledInputs(const FileModel& model,
+                                               const ServiceModel& service) {
+  std::vector<const Descriptor*> inputs;
+  std::set<const Descriptor*> seen;
+  for (int i = 0; i < service.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service, i);
+    if (IsPooledMethod(method) && seen.insert(method.descriptor->input_type()).second) {
+      inputs.push_back(method.descriptor->input_type());
     }
-
-    out->Print("}\n");
   }
+  return inputs;
+}
 
-bool HasEvent(const FileDescriptor* file){
-  for(int i = 0; i < file->message_type_count(); i++){
-    const Descriptor* message = file->message_type(i);
-    if(IsEventMessageType(message))
-      return true;
-  }
-  return false;
+int GetPooledInputIndex(const std::vector<const Descriptor*>& inputs,
+                        const Descriptor* input) {
+  return std::find(inputs.begin(), inputs.end(), input) - inputs.begin();
 }
 
-void GenerateEvent(Printer* out, const Descriptor* message, char flags){
-  if(!IsEventMessageType(message)){
-    return;
-  }
-  out->Print("$access_level$ partial class $classname$ : aelf::IEvent<$classname$>\n",
-             "access_level", GetAccessLevel(flags),
-             "classname", message->name());
-  out->Print("{\n");
-  {
-    out->Indent();
-    // GetIndexed
+void GenerateContractBaseClass(Printer *out, const FileModel& model,
+                               const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  out->Print(
+      "/// <summary>Base class for the contract of "
+      "$servicename$</summary>\n",
+      "servicename", GetServiceClassName(service));
+  out->Print("public abstract partial class $name$ : "
+             "AElf.Sdk.CSharp.CSharpSmartContract<$statetype$>\n",
+             "name", GetServerClassName(service),
+             "statetype", service_model.state_type);
+  out->Print("{\n");
+  out->Indent();
+  for (int i = 0; i < service_model.full_method_count; i++) {
+    const MethodModel& method_model = GetFullMethod(model, service_model, i);
+    const MethodDescriptor* method = method_model.descriptor;
+    if (NeedPoolInput(flags) && IsPooledMethod(method_model)) {
+      out->Print("/// <remarks>The input is recycled once the method returns, so neither it nor\n"
+                 "/// anything reachable from it may be kept.</remarks>\n");
+    }
+    out->Print(
+        "public abstract $returntype$ "
+        "$methodname$($request$$response_stream_maybe$);\n",
+        "methodname", method->name(),
+        "returntype", GetMethodReturnTypeServer(method),
+        "request", GetMethodRequestParamServer(method, flags),
+        "response_stream_maybe", GetMethodResponseStreamMaybe(method, flags));
+  }
+  out->Outdent();
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// Methods are indexed by their position in the flattened service. The
+// contract only reports calls to an IMethodInstrumentation given by the host
+// to BindService: timers, allocation counters and interlocked counters
+// aren't available to contract code, so the host measures the calls itself.
+void GenerateInstrumentation(Printer* out, const FileModel& model,
+                             const ServiceModel& service) {
+  out->Print("#region Instrumentation\n");
+  out->Print("public static readonly string[] InstrumentedMethods = new string[]\n");
+  out->Print("{\n");
+  for (int i = 0; i < service.full_method_count; i++) {
+    out->Print("  \"$methodname$\",\n",
+               "methodname", GetFullMethod(model, service, i).descriptor->name());
+  }
+  out->Print("};\n");
+  out->Print("\n");
+  out->Print("/// <summary>Implemented by the host to measure the unary calls of the contract,\n"
+             "/// methods being indexed as in InstrumentedMethods.</summary>\n");
+  out->Print("public interface IMethodInstrumentation\n");
+  out->Print("{\n");
+  out->Print("  /// <summary>Called before the method runs; the value returned is passed to OnMethodExecuted.</summary>\n");
+  out->Print("  long OnMethodStarting(int method);\n");
+  out->Print("  /// <summary>Called once the method returned or threw.</summary>\n");
+  out->Print("  void OnMethodExecuted(int method, long started);\n");
+  out->Print("}\n");
+  out->Print("\n");
+  out->Print("static TOutput __Instrument<TInput, TOutput>(IMethodInstrumentation instrumentation, int method, global::System.Func<TInput, TOutput> handler, TInput input)\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("if (instrumentation == null)\n");
+    out->Print("{\n");
+    out->Print("  return handler(input);\n");
+    out->Print("}\n");
+    out->Print("var started = instrumentation.OnMethodStarting(method);\n");
+    out->Print("try\n");
+    out->Print("{\n");
+    out->Print("  return handler(input);\n");
+    out->Print("}\n");
+    out->Print("finally\n");
+    out->Print("{\n");
+    out->Print("  instrumentation.OnMethodExecuted(method, started);\n");
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("#endregion\n");
+  out->Print("\n");
+}
+
+// Nested messages are dropped rather than cleared, so a nested message kept by
+// the contract is never changed by a later call. Only the input itself and its
+// repeated fields are recycled. Unknown fields are discarded when parsing, so
+// the known fields are all there is to reset.
+void GenerateClearInputMethod(Printer* out, const Descriptor* message) {
+  out->Print("static void __Clear($type$ input)\n", "type", GetClassName(message));
+  out->Print("{\n");
+  out->Indent();
+  for (int i = 0; i < message->field_count(); i++) {
+    const FieldDescriptor* field = message->field(i);
+    std::string value;
+    if (field->is_repeated()) {
+      out->Print("input.$name$.Clear();\n", "name", GetPropertyName(field));
+      continue;
+    }
+    switch (field->type()) {
+      case FieldDescriptor::TYPE_MESSAGE:
+      case FieldDescriptor::TYPE_GROUP:
+        value = "null";
+        break;
+      case FieldDescriptor::TYPE_STRING:
+        value = "\"\"";
+        break;
+      case FieldDescriptor::TYPE_BYTES:
+        value = "global::Google.Protobuf.ByteString.Empty";
+        break;
+      case FieldDescriptor::TYPE_BOOL:
+        value = "false";
+        break;
+      default:
+        value = "0";
+        break;
+    }
+    out->Print("input.$name$ = $value$;\n", "name", GetPropertyName(field), "value", value);
+  }
+  out->Outdent();
+  out->Print("}\n");
+}
+
+// Pooled methods parse into an instance recycled by a pool created in
+// BindService, so the pool lives as long as the service definition, which
+// runs one call at a time. The parser is built on the public MessageParser
+// API: its factory hands out the cleared free instance, and it discards
+// unknown fields, which couldn't be cleared otherwise. The instance goes back
+// to the pool when the method returns, unless it is the output or was rented
+// again by a nested call.
+void GenerateInputPool(Printer* out, const FileModel& model,
+                       const ServiceModel& service) {
+  out->Print("#region Input Pool\n");
+  out->Print("sealed class __InputPool<T> where T : class, global::Google.Protobuf.IMessage<T>, new()\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("readonly global::System.Action<T> __clear;\n");
+    out->Print("readonly global::Google.Protobuf.MessageParser<T> __parser;\n");
+    out->Print("T __free;\n");
+    out->Print("T __rented;\n");
+    out->Print("\n");
+    out->Print("internal __InputPool(global::System.Action<T> clear)\n");
+    out->Print("{\n");
+    out->Print("  __clear = clear;\n");
+    out->Print("  __parser = new global::Google.Protobuf.MessageParser<T>(Take).WithDiscardUnknownFields(true);\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("T Take()\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var input = __free;\n");
+      out->Print("__free = null;\n");
+      out->Print("if (input == null)\n");
+      out->Print("{\n");
+      out->Print("  return new T();\n");
+      out->Print("}\n");
+      out->Print("__clear(input);\n");
+      out->Print("return input;\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("T Rent(byte[] bytes)\n");
+    out->Print("{\n");
+    out->Print("  var input = __parser.ParseFrom(bytes);\n");
+    out->Print("  __rented = input;\n");
+    out->Print("  return input;\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("internal aelf::Method<T, TOutput> Bind<TOutput>(aelf::Method<T, TOutput> method)\n");
+    out->Print("{\n");
+    out->Print("  return new aelf::Method<T, TOutput>(method.Type, method.ServiceName, method.Name,\n");
+    out->Print("      aelf::Marshallers.Create(method.RequestMarshaller.Serializer, Rent),\n");
+    out->Print("      method.ResponseMarshaller);\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("internal TOutput Return<TOutput>(T input, TOutput output)\n");
+    out->Print("{\n");
+    out->Print("  if (ReferenceEquals(input, __rented) && !ReferenceEquals(input, output))\n");
+    out->Print("  {\n");
+    out->Print("    __free = input;\n");
+    out->Print("  }\n");
+    out->Print("  __rented = null;\n");
+    out->Print("  return output;\n");
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+  std::vector<const Descriptor*> inputs = GetPooledInputs(model, service);
+  for (size_t i = 0; i < inputs.size(); i++) {
+    out->Print("\n");
+    GenerateClearInputMethod(out, inputs[i]);
+  }
+  out->Print("#endregion\n");
+  out->Print("\n");
+}
+
+void GenerateBindServiceMethod(Printer* out, const FileModel& model,
+                               const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  if (NeedInstrument(flags)) {
+    out->Print(
+        "public static aelf::ServerServiceDefinition BindService($implclass$ "
+        "serviceImpl)\n",
+        "implclass", GetServerClassName(service));
+    out->Print("{\n");
+    out->Print("  return BindService(serviceImpl, null);\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print(
+        "public static aelf::ServerServiceDefinition BindService($implclass$ "
+        "serviceImpl, IMethodInstrumentation instrumentation)\n",
+        "implclass", GetServerClassName(service));
+  } else {
+    out->Print(
+        "public static aelf::ServerServiceDefinition BindService($implclass$ "
+        "serviceImpl)\n",
+        "implclass", GetServerClassName(service));
+  }
+  out->Print("{\n");
+  out->Indent();
+
+  // Instrumented handlers are bound to the contract once here rather than on
+  // every call by the lambdas below.
+  for (int i = 0; i < service_model.full_method_count; i++) {
+    const MethodDescriptor* method = GetFullMethod(model, service_model, i).descriptor;
+    if (NeedInstrument(flags) && GetMethodType(method) == METHODTYPE_NO_STREAMING) {
+      std::ostringstream index;
+      index << i;
+      out->Print("var __handler$index$ = new global::System.Func<$request$, $response$>(serviceImpl.$methodname$);\n",
+                 "index", index.str(),
+                 "request", GetClassName(method->input_type()),
+                 "response", GetClassName(method->output_type()),
+                 "methodname", method->name());
+    }
+  }
+
+  std::vector<const Descriptor*> pooled_inputs;
+  if (NeedPoolInput(flags)) {
+    pooled_inputs = GetPooledInputs(model, service_model);
+  }
+  for (size_t i = 0; i < pooled_inputs.size(); i++) {
+    std::ostringstream index;
+    index << i;
+    out->Print("var __pool$index$ = new __InputPool<$request$>(__Clear);\n",
+               "index", index.str(), "request", GetClassName(pooled_inputs[i]));
+  }
+
+  out->Print("return aelf::ServerServiceDefinition.CreateBuilder()");
+  out->Indent();
+  out->Indent();
+  out->Print("\n.AddDescriptors(Descriptors)");
+  for (int i = 0; i < service_model.full_method_count; i++) {
+    const MethodModel& method_model = GetFullMethod(model, service_model, i);
+    const MethodDescriptor* method = method_model.descriptor;
+    bool instrumented = NeedInstrument(flags) && GetMethodType(method) == METHODTYPE_NO_STREAMING;
+    bool pooled = NeedPoolInput(flags) && IsPooledMethod(method_model);
+    if (instrumented || pooled) {
+      std::ostringstream index;
+      index << i;
+      std::string methodfield = GetMethodFieldReference(service_model, method_model, flags);
+      std::string call = instrumented
+          ? "__Instrument(instrumentation, " + index.str() + ", __handler" + index.str() + ", input)"
+          : "serviceImpl." + method->name() + "(input)";
+      if (pooled) {
+        std::ostringstream pool;
+        pool << "__pool" << GetPooledInputIndex(pooled_inputs, method->input_type());
+        methodfield = pool.str() + ".Bind(" + methodfield + ")";
+        call = pool.str() + ".Return(input, " + call + ")";
+      }
+      out->Print("\n.AddMethod($methodfield$, input => $call$)",
+                 "methodfield", methodfield, "call", call);
+      continue;
+    }
+    if (NeedChunkedInput(flags) && IsChunkedMethod(method)) {
+      out->Print("\n.AddMethod(__Chunked($methodfield$, $request$.Parser), serviceImpl.$methodname$)",
+                 "methodfield", GetMethodFieldReference(service_model, method_model, flags),
+                 "request", GetClassName(method->input_type()), "methodname", method->name());
+      continue;
+    }
+    out->Print("\n.AddMethod($methodfield$, serviceImpl.$methodname$)",
+               "methodfield", GetMethodFieldReference(service_model, method_model, flags), "methodname",
+               method->name());
+  }
+  if (NeedExecuteBatch(flags)) {
+    out->Print("\n.AddMethod(__Method_ExecuteBatch, input => new global::Google.Protobuf.WellKnownTypes.BytesValue\n"
+               "{\n"
+               "  Value = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(ExecuteBatch(serviceImpl, input.Value.ToByteArray()))\n"
+               "})");
+  }
+  out->Print(".Build();\n");
+  out->Outdent();
+  out->Outdent();
+
+  out->Outdent();
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// Executes a payload built by the stub batch. The whole payload is decoded
+// first: the count of calls, then each (method name, length-delimited input)
+// record, whose input is parsed. A count that doesn't match the records,
+// bytes left after them or a method that can't be batched fail the batch
+// before any call runs. The calls are then dispatched to the contract in
+// order and their outputs written as length-delimited records into a single
+// buffer. ExecuteBatch is bound as a method of the contract taking and
+// returning the payloads as BytesValue.
+void GenerateExecuteBatchMethod(Printer* out, const FileModel& model,
+                                const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  out->Print("static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.BytesValue, global::Google.Protobuf.WellKnownTypes.BytesValue> __Method_ExecuteBatch =\n");
+  out->Print("    new aelf::Method<global::Google.Protobuf.WellKnownTypes.BytesValue, global::Google.Protobuf.WellKnownTypes.BytesValue>(\n");
+  out->Print("        aelf::MethodType.Action,\n");
+  out->Print("        __ServiceName,\n");
+  out->Print("        \"ExecuteBatch\",\n");
+  out->Print("        aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.BytesValue.Parser.ParseFrom),\n");
+  out->Print("        aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.BytesValue.Parser.ParseFrom));\n");
+  out->Print("\n");
+  out->Print("public static byte[] ExecuteBatch($implclass$ serviceImpl, byte[] batch)\n",
+             "implclass", GetServerClassName(service));
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var input = new global::Google.Protobuf.CodedInputStream(batch);\n");
+    out->Print("var count = input.ReadInt32();\n");
+    out->Print("// Each call takes at least two bytes.\n");
+    out->Print("if (count < 0 || count > batch.Length / 2)\n");
+    out->Print("{\n");
+    out->Print("  throw new global::System.InvalidOperationException(\"Invalid count of calls in the batch: \" + count + \".\");\n");
+    out->Print("}\n");
+    out->Print("var calls = new global::System.Func<byte[]>[count];\n");
+    out->Print("for (var i = 0; i < count; i++)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("if (input.IsAtEnd)\n");
+      out->Print("{\n");
+      out->Print("  throw new global::System.InvalidOperationException(\"The batch holds \" + i + \" calls instead of \" + count + \".\");\n");
+      out->Print("}\n");
+      out->Print("var methodName = input.ReadString();\n");
+      out->Print("var request = input.ReadBytes().ToByteArray();\n");
+      out->Print("switch (methodName)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        for (int i = 0; i < service_model.full_method_count; i++) {
+          const MethodModel& method_model = GetFullMethod(model, service_model, i);
+          const MethodDescriptor* method = method_model.descriptor;
+          if (GetMethodType(method) != METHODTYPE_NO_STREAMING) {
+            continue;
+          }
+          std::map<grpc::string, grpc::string> vars;
+          vars["methodname"] = method->name();
+          vars["methodfield"] = GetMethodFieldReference(service_model, method_model, flags);
+          out->Print(vars, "case \"$methodname$\":\n");
+          out->Print("{\n");
+          out->Print(vars, "  var methodInput = $methodfield$.RequestMarshaller.Deserializer(request);\n");
+          out->Print(vars, "  calls[i] = () => $methodfield$.ResponseMarshaller.Serializer(serviceImpl.$methodname$(methodInput));\n");
+          out->Print("  break;\n");
+          out->Print("}\n");
+        }
+        out->Print("default:\n");
+        out->Print("  throw new global::System.InvalidOperationException(\"Method \" + methodName + \" can't be executed in a batch.\");\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Print("if (!input.IsAtEnd)\n");
+    out->Print("{\n");
+    out->Print("  throw new global::System.InvalidOperationException(\"The batch holds more than \" + count + \" calls.\");\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("var outputs = new byte[count][];\n");
+    out->Print("var size = 0;\n");
+    out->Print("for (var i = 0; i < count; i++)\n");
+    out->Print("{\n");
+    out->Print("  outputs[i] = calls[i]();\n");
+    out->Print("  size += global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(outputs[i].Length) + outputs[i].Length;\n");
+    out->Print("}\n");
+    out->Print("var buffer = new byte[size];\n");
+    out->Print("var stream = new global::Google.Protobuf.CodedOutputStream(buffer);\n");
+    out->Print("foreach (var bytes in outputs)\n");
+    out->Print("{\n");
+    out->Print("  stream.WriteBytes(global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(bytes));\n");
+    out->Print("}\n");
+    out->Print("stream.CheckNoSpaceLeft();\n");
+    out->Print("return buffer;\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// The benchmarks go through the same marshallers as a real call: the input
+// is parsed from bytes, the contract base is called and the output is
+// serialized. The contract and the inputs are provided by implementing the
+// partial setup methods. Streaming methods are not benchmarked.
+void GenerateBenchmarkClass(Printer* out, const FileModel& model,
+                            const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  out->Print("[global::BenchmarkDotNet.Attributes.MemoryDiagnoser]\n");
+  out->Print("public partial class $classname$\n",
+             "classname", GetBenchmarkClassName(service));
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("$contractclass$ __contract;\n",
+               "contractclass", GetServerClassName(service));
+    Methods methods;
+    for (int i = 0; i < service_model.full_method_count; i++) {
+      const MethodModel& method = GetFullMethod(model, service_model, i);
+      if (GetMethodType(method.descriptor) == METHODTYPE_NO_STREAMING) {
+        methods.push_back(&method);
+      }
+    }
+    for (size_t i = 0; i < methods.size(); i++) {
+      out->Print("byte[] __$methodname$Input;\n",
+                 "methodname", methods[i]->descriptor->name());
+    }
+    out->Print("\n");
+
+    out->Print("partial void SetupContract(ref $contractclass$ contract);\n",
+               "contractclass", GetServerClassName(service));
+    for (size_t i = 0; i < methods.size(); i++) {
+      out->Print("partial void Setup$methodname$Input(ref $request$ input);\n",
+                 "methodname", methods[i]->descriptor->name(),
+                 "request", GetClassName(methods[i]->descriptor->input_type()));
+    }
+    out->Print("\n");
+
+    out->Print("[global::BenchmarkDotNet.Attributes.GlobalSetup]\n");
+    out->Print("public void GlobalSetup()\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("SetupContract(ref __contract);\n");
+      for (size_t i = 0; i < methods.size(); i++) {
+        std::map<grpc::string, grpc::string> vars;
+        vars["methodname"] = methods[i]->descriptor->name();
+        vars["methodfield"] = GetMethodFieldReference(service_model, *methods[i], flags);
+        vars["request"] = GetClassName(methods[i]->descriptor->input_type());
+        out->Print("{\n");
+        out->Print(vars, "  var input = new $request$();\n");
+        out->Print(vars, "  Setup$methodname$Input(ref input);\n");
+        out->Print(vars, "  __$methodname$Input = $methodfield$.RequestMarshaller.Serializer(input);\n");
+        out->Print("}\n");
+      }
+      out->Outdent();
+    }
+    out->Print("}\n");
+
+    for (size_t i = 0; i < methods.size(); i++) {
+      std::map<grpc::string, grpc::string> vars;
+      vars["methodname"] = methods[i]->descriptor->name();
+      vars["methodfield"] = GetMethodFieldReference(service_model, *methods[i], flags);
+      out->Print("\n");
+      out->Print("[global::BenchmarkDotNet.Attributes.Benchmark]\n");
+      out->Print(vars, "public byte[] $methodname$()\n");
+      out->Print("{\n");
+      out->Print(vars, "  var input = $methodfield$.RequestMarshaller.Deserializer(__$methodname$Input);\n");
+      out->Print(vars, "  return $methodfield$.ResponseMarshaller.Serializer(__contract.$methodname$(input));\n");
+      out->Print("}\n");
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// Replays a captured trace against the contract base. The trace is a
+// sequence of length-delimited records, each a message with the method name
+// as field 1 and the input bytes as field 2. Every record is dispatched
+// through the marshallers of its method, like a real call, and latencies and
+// allocations are collected per method. Streaming methods, unknown methods
+// and failed calls are counted but not timed.
+void GenerateReplayClass(Printer* out, const FileModel& model,
+                         const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  Methods methods;
+  for (int i = 0; i < service_model.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service_model, i);
+    if (GetMethodType(method.descriptor) == METHODTYPE_NO_STREAMING) {
+      methods.push_back(&method);
+    }
+  }
+  std::ostringstream count;
+  count << methods.size();
+  out->Print("public static class $classname$\n", "classname", GetReplayClassName(service));
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("public sealed class MethodReport\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("internal readonly global::System.Collections.Generic.List<long> __elapsedTicks = new global::System.Collections.Generic.List<long>();\n");
+      out->Print("\n");
+      out->Print("internal MethodReport(string method)\n");
+      out->Print("{\n");
+      out->Print("  Method = method;\n");
+      out->Print("}\n");
+      out->Print("\n");
+      out->Print("public string Method { get; }\n");
+      out->Print("public int Calls { get { return __elapsedTicks.Count; } }\n");
+      out->Print("public int Failures { get; internal set; }\n");
+      out->Print("public long AllocatedBytes { get; internal set; }\n");
+      out->Print("\n");
+      out->Print("// Nearest-rank percentile of the call latencies, in microseconds.\n");
+      out->Print("public double GetLatencyPercentile(double percentile)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("if (__elapsedTicks.Count == 0)\n");
+        out->Print("{\n");
+        out->Print("  return 0;\n");
+        out->Print("}\n");
+        out->Print("var rank = (int) global::System.Math.Ceiling(percentile / 100 * __elapsedTicks.Count);\n");
+        out->Print("var ticks = __elapsedTicks[global::System.Math.Min(__elapsedTicks.Count, global::System.Math.Max(rank, 1)) - 1];\n");
+        out->Print("return ticks * 1000000.0 / global::System.Diagnostics.Stopwatch.Frequency;\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Print("\n");
+
+    out->Print("public sealed class Report\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("internal Report(global::System.Collections.Generic.IReadOnlyList<MethodReport> methods, int skippedRecords)\n");
+      out->Print("{\n");
+      out->Print("  Methods = methods;\n");
+      out->Print("  SkippedRecords = skippedRecords;\n");
+      out->Print("}\n");
+      out->Print("\n");
+      out->Print("public global::System.Collections.Generic.IReadOnlyList<MethodReport> Methods { get; }\n");
+      out->Print("// Records of unknown or streaming methods.\n");
+      out->Print("public int SkippedRecords { get; }\n");
+      out->Print("\n");
+      out->Print("public override string ToString()\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("var builder = new global::System.Text.StringBuilder();\n");
+        out->Print("builder.AppendLine(\"method\\tcalls\\tfailures\\tp50_us\\tp90_us\\tp99_us\\tmax_us\\tallocated_bytes_per_call\");\n");
+        out->Print("foreach (var method in Methods)\n");
+        out->Print("{\n");
+        {
+          out->Indent();
+          out->Print("builder.AppendFormat(global::System.Globalization.CultureInfo.InvariantCulture,\n");
+          out->Print("    \"{0}\\t{1}\\t{2}\\t{3:F1}\\t{4:F1}\\t{5:F1}\\t{6:F1}\\t{7}\",\n");
+          out->Print("    method.Method, method.Calls, method.Failures,\n");
+          out->Print("    method.GetLatencyPercentile(50), method.GetLatencyPercentile(90),\n");
+          out->Print("    method.GetLatencyPercentile(99), method.GetLatencyPercentile(100),\n");
+          out->Print("    method.Calls == 0 ? 0 : method.AllocatedBytes / method.Calls);\n");
+          out->Print("builder.AppendLine();\n");
+          out->Outdent();
+        }
+        out->Print("}\n");
+        out->Print("builder.AppendLine(\"skipped\\t\" + SkippedRecords);\n");
+        out->Print("return builder.ToString();\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Print("\n");
+
+    out->Print("public static Report Run($contractclass$ contract, global::System.IO.Stream trace)\n",
+               "contractclass", GetServerClassName(service));
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var methods = new MethodReport[$count$]\n", "count", count.str());
+      out->Print("{\n");
+      for (size_t i = 0; i < methods.size(); i++) {
+        out->Print("  new MethodReport(\"$methodname$\"),\n",
+                   "methodname", methods[i]->descriptor->name());
+      }
+      out->Print("};\n");
+      out->Print("var skipped = 0;\n");
+      out->Print("var records = new global::Google.Protobuf.CodedInputStream(trace, true);\n");
+      out->Print("while (!records.IsAtEnd)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("var record = new global::Google.Protobuf.CodedInputStream(records.ReadBytes().ToByteArray());\n");
+        out->Print("var name = \"\";\n");
+        out->Print("var input = new byte[0];\n");
+        out->Print("uint tag;\n");
+        out->Print("while ((tag = record.ReadTag()) != 0)\n");
+        out->Print("{\n");
+        {
+          out->Indent();
+          out->Print("switch (tag)\n");
+          out->Print("{\n");
+          out->Print("  case 10:\n");
+          out->Print("    name = record.ReadString();\n");
+          out->Print("    break;\n");
+          out->Print("  case 18:\n");
+          out->Print("    input = record.ReadBytes().ToByteArray();\n");
+          out->Print("    break;\n");
+          out->Print("  default:\n");
+          out->Print("    record.SkipLastField();\n");
+          out->Print("    break;\n");
+          out->Print("}\n");
+          out->Outdent();
+        }
+        out->Print("}\n");
+        out->Print("var start = global::System.Diagnostics.Stopwatch.GetTimestamp();\n");
+        out->Print("var startAllocatedBytes = global::System.GC.GetAllocatedBytesForCurrentThread();\n");
+        out->Print("var method = -1;\n");
+        out->Print("try\n");
+        out->Print("{\n");
+        {
+          out->Indent();
+          out->Print("switch (name)\n");
+          out->Print("{\n");
+          {
+            out->Indent();
+            for (size_t i = 0; i < methods.size(); i++) {
+              std::map<grpc::string, grpc::string> vars;
+              std::ostringstream index;
+              index << i;
+              vars["index"] = index.str();
+              vars["methodname"] = methods[i]->descriptor->name();
+              vars["methodfield"] = GetMethodFieldReference(service_model, *methods[i], flags);
+              out->Print(vars, "case \"$methodname$\":\n");
+              out->Print(vars, "  method = $index$;\n");
+              out->Print(vars, "  $methodfield$.ResponseMarshaller.Serializer(contract.$methodname$($methodfield$.RequestMarshaller.Deserializer(input)));\n");
+              out->Print("  break;\n");
+            }
+            out->Print("default:\n");
+            out->Print("  skipped++;\n");
+            out->Print("  continue;\n");
+            out->Outdent();
+          }
+          out->Print("}\n");
+          out->Outdent();
+        }
+        out->Print("}\n");
+        out->Print("catch (global::System.Exception)\n");
+        out->Print("{\n");
+        out->Print("  methods[method].Failures++;\n");
+        out->Print("  continue;\n");
+        out->Print("}\n");
+        out->Print("var elapsed = global::System.Diagnostics.Stopwatch.GetTimestamp() - start;\n");
+        out->Print("methods[method].AllocatedBytes += global::System.GC.GetAllocatedBytesForCurrentThread() - startAllocatedBytes;\n");
+        out->Print("methods[method].__elapsedTicks.Add(elapsed);\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Print("foreach (var method in methods)\n");
+      out->Print("{\n");
+      out->Print("  method.__elapsedTicks.Sort();\n");
+      out->Print("}\n");
+      out->Print("return new Report(methods, skipped);\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// Calls the contract base in process, skipping marshalling and the
+// transaction path. With roundTrip, inputs and outputs still go through the
+// marshallers, to check that the contract behaves the same on parsed
+// messages. Streaming methods are left out.
+void GenerateDirectStubClass(Printer* out, const FileModel& model,
+                             const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  std::map<grpc::string, grpc::string> vars;
+  vars["classname"] = GetDirectStubClassName(service);
+  vars["contractclass"] = GetServerClassName(service);
+  out->Print(vars, "public class $classname$\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print(vars, "readonly $contractclass$ __contract;\n");
+    out->Print("readonly bool __roundTrip;\n");
+    out->Print("\n");
+    out->Print(vars, "public $classname$($contractclass$ contract, bool roundTrip = false)\n");
+    out->Print("{\n");
+    out->Print("  __contract = contract;\n");
+    out->Print("  __roundTrip = roundTrip;\n");
+    out->Print("}\n");
+    for (int i = 0; i < service_model.full_method_count; i++) {
+      const MethodModel& method_model = GetFullMethod(model, service_model, i);
+      const MethodDescriptor* method = method_model.descriptor;
+      if (GetMethodType(method) != METHODTYPE_NO_STREAMING) {
+        continue;
+      }
+      vars["methodname"] = method->name();
+      vars["methodfield"] = GetMethodFieldReference(service_model, method_model, flags);
+      vars["request"] = GetClassName(method->input_type());
+      vars["response"] = GetClassName(method->output_type());
+      out->Print("\n");
+      out->Print(vars, "public $response$ $methodname$($request$ input)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("if (!__roundTrip)\n");
+        out->Print("{\n");
+        out->Print(vars, "  return __contract.$methodname$(input);\n");
+        out->Print("}\n");
+        out->Print(vars, "var method = $methodfield$;\n");
+        out->Print(vars, "var output = __contract.$methodname$(method.RequestMarshaller.Deserializer(method.RequestMarshaller.Serializer(input)));\n");
+        out->Print("return method.ResponseMarshaller.Deserializer(method.ResponseMarshaller.Serializer(output));\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// The method stub is created by __factory.Create once per stub and cached, so
+// repeated property accesses don't allocate one each. The ValueTask methods
+// only give callers written against ValueTask the shape they expect: they wrap
+// the Task of the method stub, which is still allocated for every call.
+void GenerateValueTaskStubMembers(Printer *out, const ServiceModel& service_model,
+                                  const MethodModel& method_model, unsigned int flags) {
+  const MethodDescriptor* method = method_model.descriptor;
+  std::map<grpc::string, grpc::string> vars;
+  vars["methodname"] = method->name();
+  vars["methodfield"] = GetMethodFieldReference(service_model, method_model, flags);
+  vars["request"] = GetClassName(method->input_type());
+  vars["response"] = GetClassName(method->output_type());
+  out->Print(vars, "aelf::IMethodStub<$request$, $response$> __$methodname$;\n\n");
+  out->Print(vars, "public aelf::IMethodStub<$request$, $response$> $methodname$\n");
+  out->Print("{\n");
+  out->Print(vars, "  get { return __$methodname$ ?? (__$methodname$ = __factory.Create($methodfield$)); }\n");
+  out->Print("}\n\n");
+  out->Print(vars, "/// <summary>Wraps the Task of $methodname$.CallAsync; doesn't save its allocation.</summary>\n");
+  out->Print(vars, "public global::System.Threading.Tasks.ValueTask<$response$> $methodname$CallValueTask($request$ input)\n");
+  out->Print("{\n");
+  out->Print(vars, "  return new global::System.Threading.Tasks.ValueTask<$response$>($methodname$.CallAsync(input));\n");
+  out->Print("}\n\n");
+  out->Print(vars, "/// <summary>Wraps the Task of $methodname$.SendAsync; doesn't save its allocation.</summary>\n");
+  out->Print(vars, "public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<$response$>> $methodname$SendValueTask($request$ input)\n");
+  out->Print("{\n");
+  out->Print(vars, "  return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<$response$>>($methodname$.SendAsync(input));\n");
+  out->Print("}\n\n");
+}
+
+void AppendVarint(google::protobuf::uint64 value, grpc::string* data) {
+  while (value >= 0x80) {
+    data->push_back(static_cast<char>((value & 0x7F) | 0x80));
+    value >>= 7;
+  }
+  data->push_back(static_cast<char>(value));
+}
+
+std::string GetByteArrayLiteral(const grpc::string& data) {
+  std::string literal = "{";
+  for (size_t i = 0; i < data.size(); i++) {
+    char hex[8];
+    snprintf(hex, sizeof(hex), " 0x%02X,", static_cast<unsigned char>(data[i]));
+    literal += hex;
+  }
+  if (!data.empty()) {
+    literal.resize(literal.size() - 1);
+  }
+  return literal + " }";
+}
+
+// The method_name field (5) of a transaction calling method.
+grpc::string GetMethodNameField(const MethodDescriptor* method) {
+  grpc::string field;
+  AppendVarint(WireFormatLite::MakeTag(5, WireFormatLite::WIRETYPE_LENGTH_DELIMITED), &field);
+  AppendVarint(method->name().size(), &field);
+  return field + method->name();
+}
+
+// A transaction is encoded as its constant leading fields (from, to,
+// ref_block_number, ref_block_prefix and method_name), which are encoded
+// once per template, followed by params and signature. Fields are written
+// in field number order with default values left out, so the unsigned
+// encoding is the same as serializing the transaction.
+void GenerateTransactionTemplateClass(Printer* out) {
+  grpc::string signature_tag;
+  AppendVarint(WireFormatLite::MakeTag(10000, WireFormatLite::WIRETYPE_LENGTH_DELIMITED),
+               &signature_tag);
+  out->Print("public sealed class TransactionTemplate<TInput>\n");
+  out->Print("    where TInput : global::Google.Protobuf.IMessage<TInput>\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("static readonly byte[] __SignatureTag = new byte[] $tag$;\n",
+               "tag", GetByteArrayLiteral(signature_tag));
+    out->Print("readonly byte[] __prefix;\n");
+    out->Print("\n");
+    out->Print("internal TransactionTemplate(byte[] header, byte[] methodNameField)\n");
+    out->Print("{\n");
+    out->Print("  __prefix = new byte[header.Length + methodNameField.Length];\n");
+    out->Print("  global::System.Buffer.BlockCopy(header, 0, __prefix, 0, header.Length);\n");
+    out->Print("  global::System.Buffer.BlockCopy(methodNameField, 0, __prefix, header.Length, methodNameField.Length);\n");
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public byte[] Encode(TInput input, global::Google.Protobuf.ByteString signature = null)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var paramsSize = input.CalculateSize();\n");
+      out->Print("var size = __prefix.Length;\n");
+      out->Print("if (paramsSize != 0)\n");
+      out->Print("{\n");
+      out->Print("  size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(paramsSize) + paramsSize;\n");
+      out->Print("}\n");
+      out->Print("if (signature != null && !signature.IsEmpty)\n");
+      out->Print("{\n");
+      out->Print("  size += __SignatureTag.Length + global::Google.Protobuf.CodedOutputStream.ComputeBytesSize(signature);\n");
+      out->Print("}\n");
+      out->Print("var buffer = new byte[size];\n");
+      out->Print("global::System.Buffer.BlockCopy(__prefix, 0, buffer, 0, __prefix.Length);\n");
+      out->Print("var offset = __prefix.Length;\n");
+      out->Print("if (paramsSize != 0)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("buffer[offset++] = 0x32;\n");
+        out->Print("WriteLength(buffer, ref offset, paramsSize);\n");
+        out->Print("global::Google.Protobuf.MessageExtensions.WriteTo(input, new global::System.Span<byte>(buffer, offset, paramsSize));\n");
+        out->Print("offset += paramsSize;\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Print("if (signature != null && !signature.IsEmpty)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("global::System.Buffer.BlockCopy(__SignatureTag, 0, buffer, offset, __SignatureTag.Length);\n");
+        out->Print("offset += __SignatureTag.Length;\n");
+        out->Print("WriteLength(buffer, ref offset, signature.Length);\n");
+        out->Print("signature.Span.CopyTo(new global::System.Span<byte>(buffer, offset, signature.Length));\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Print("return buffer;\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("static void WriteLength(byte[] buffer, ref int offset, int length)\n");
+    out->Print("{\n");
+    out->Print("  var value = (uint) length;\n");
+    out->Print("  while (value >= 0x80)\n");
+    out->Print("  {\n");
+    out->Print("    buffer[offset++] = (byte) (value | 0x80);\n");
+    out->Print("    value >>= 7;\n");
+    out->Print("  }\n");
+    out->Print("  buffer[offset++] = (byte) value;\n");
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+}
+
+void GenerateEncodeTransactionHeaderMethod(Printer* out) {
+  out->Print("public static byte[] EncodeTransactionHeader(global::AElf.Types.Address from, global::AElf.Types.Address to, long refBlockNumber, global::Google.Protobuf.ByteString refBlockPrefix)\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var size = 0;\n");
+    out->Print("if (from != null)\n");
+    out->Print("{\n");
+    out->Print("  size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeMessageSize(from);\n");
+    out->Print("}\n");
+    out->Print("if (to != null)\n");
+    out->Print("{\n");
+    out->Print("  size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeMessageSize(to);\n");
+    out->Print("}\n");
+    out->Print("if (refBlockNumber != 0)\n");
+    out->Print("{\n");
+    out->Print("  size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeInt64Size(refBlockNumber);\n");
+    out->Print("}\n");
+    out->Print("if (refBlockPrefix != null && !refBlockPrefix.IsEmpty)\n");
+    out->Print("{\n");
+    out->Print("  size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeBytesSize(refBlockPrefix);\n");
+    out->Print("}\n");
+    out->Print("var buffer = new byte[size];\n");
+    out->Print("var output = new global::Google.Protobuf.CodedOutputStream(buffer);\n");
+    out->Print("if (from != null)\n");
+    out->Print("{\n");
+    out->Print("  output.WriteRawTag(10);\n");
+    out->Print("  output.WriteMessage(from);\n");
+    out->Print("}\n");
+    out->Print("if (to != null)\n");
+    out->Print("{\n");
+    out->Print("  output.WriteRawTag(18);\n");
+    out->Print("  output.WriteMessage(to);\n");
+    out->Print("}\n");
+    out->Print("if (refBlockNumber != 0)\n");
+    out->Print("{\n");
+    out->Print("  output.WriteRawTag(24);\n");
+    out->Print("  output.WriteInt64(refBlockNumber);\n");
+    out->Print("}\n");
+    out->Print("if (refBlockPrefix != null && !refBlockPrefix.IsEmpty)\n");
+    out->Print("{\n");
+    out->Print("  output.WriteRawTag(34);\n");
+    out->Print("  output.WriteBytes(refBlockPrefix);\n");
+    out->Print("}\n");
+    out->Print("output.CheckNoSpaceLeft();\n");
+    out->Print("return buffer;\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+}
+
+// The method name is encoded at generation time.
+void GenerateTransactionTemplateMethod(Printer* out, const MethodDescriptor* method) {
+  std::map<grpc::string, grpc::string> vars;
+  vars["methodname"] = method->name();
+  vars["request"] = GetClassName(method->input_type());
+  vars["field"] = GetByteArrayLiteral(GetMethodNameField(method));
+  out->Print(vars, "static readonly byte[] __$methodname$MethodNameField = new byte[] $field$;\n\n");
+  out->Print(vars, "public TransactionTemplate<$request$> Create$methodname$Template(byte[] header)\n");
+  out->Print("{\n");
+  out->Print(vars, "  return new TransactionTemplate<$request$>(header, __$methodname$MethodNameField);\n");
+  out->Print("}\n\n");
+}
+
+void GenerateStubClass(Printer *out, const FileModel& model,
+                       const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  out->Print("public class $stubname$ : aelf::ContractStubBase\n",
+             "stubname", GetStubClassName(service));
+  out->Print("{\n");
+  {
+    out->Indent();
+    if (NeedStubBatch(flags)) {
+      out->Print("public $batchname$ CreateBatch()\n",
+                 "batchname", GetStubBatchClassName(service));
+      out->Print("{\n");
+      out->Print("  return new $batchname$();\n",
+                 "batchname", GetStubBatchClassName(service));
+      out->Print("}\n\n");
+    }
+    if (NeedStubTransactionTemplate(flags)) {
+      GenerateEncodeTransactionHeaderMethod(out);
+    }
+    for (int i = 0; i < service_model.full_method_count; i++) {
+      const MethodModel& method_model = GetFullMethod(model, service_model, i);
+      const MethodDescriptor* method = method_model.descriptor;
+      if (NeedStubValueTask(flags)) {
+        GenerateValueTaskStubMembers(out, service_model, method_model, flags);
+      } else {
+        out->Print(
+            "public aelf::IMethodStub<$request$, $response$> $fieldname$\n",
+            "fieldname", method->name(),
+            "request", GetClassName(method->input_type()),
+            "response", GetClassName(method->output_type()));
+        out->Print("{\n");
+        {
+          out->Indent();
+          out->Print("get { return __factory.Create($fieldname$); }\n",
+                     "fieldname", GetMethodFieldReference(service_model, method_model, flags));
+          out->Outdent();
+        }
+        out->Print("}\n\n");
+      }
+
+      if (NeedStubTransactionTemplate(flags)) {
+        GenerateTransactionTemplateMethod(out, method);
+      }
+    }
+    out->Outdent();
+  }
+
+  out->Print("}\n");
+}
+
+
+void GenerateBatchCallClass(Printer *out) {
+  out->Print("public sealed class BatchCall<TOutput>\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("internal BatchCall(int index)\n");
+    out->Print("{\n");
+    out->Print("  Index = index;\n");
+    out->Print("}\n\n");
+    out->Print("public int Index { get; }\n");
+    out->Print("public TOutput Output { get; internal set; }\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+}
+
+// The batch queues typed calls and serializes them into one multicall
+// payload: the count of calls followed by a (method name, length-delimited
+// input) record per call. The results payload holds one length-delimited
+// output per call, in the same order, and nothing else. Both are the format
+// of the ExecuteBatch method of the container generated for the contract.
+// Streaming methods can't be batched.
+void GenerateStubBatchClass(Printer *out, const FileModel& model,
+                            const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  out->Print("public class $batchname$\n",
+             "batchname", GetStubBatchClassName(service));
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("readonly global::System.Collections.Generic.List<string> __methodNames = new global::System.Collections.Generic.List<string>();\n");
+    out->Print("readonly global::System.Collections.Generic.List<global::Google.Protobuf.IMessage> __inputs = new global::System.Collections.Generic.List<global::Google.Protobuf.IMessage>();\n");
+    out->Print("readonly global::System.Collections.Generic.List<global::System.Action<byte[]>> __outputReaders = new global::System.Collections.Generic.List<global::System.Action<byte[]>>();\n");
+    out->Print("\n");
+    out->Print("public int Count { get { return __inputs.Count; } }\n");
+    out->Print("\n");
+
+    for (int i = 0; i < service_model.full_method_count; i++) {
+      const MethodModel& method_model = GetFullMethod(model, service_model, i);
+      const MethodDescriptor* method = method_model.descriptor;
+      if (GetMethodType(method) != METHODTYPE_NO_STREAMING) {
+        continue;
+      }
+      out->Print("public BatchCall<$response$> $methodname$($request$ input)\n",
+                 "methodname", method->name(),
+                 "request", GetClassName(method->input_type()),
+                 "response", GetClassName(method->output_type()));
+      out->Print("{\n");
+      out->Print("  return __Add($methodfield$, input);\n",
+                 "methodfield", GetMethodFieldReference(service_model, method_model, flags));
+      out->Print("}\n\n");
+    }
+
+    out->Print("BatchCall<TOutput> __Add<TInput, TOutput>(aelf::Method<TInput, TOutput> method, TInput input)\n");
+    out->Print("    where TInput : global::Google.Protobuf.IMessage\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var call = new BatchCall<TOutput>(__inputs.Count);\n");
+      out->Print("__methodNames.Add(method.Name);\n");
+      out->Print("__inputs.Add(input);\n");
+      out->Print("__outputReaders.Add(bytes => call.Output = method.ResponseMarshaller.Deserializer(bytes));\n");
+      out->Print("return call;\n");
+      out->Outdent();
+    }
+    out->Print("}\n\n");
+
+    out->Print("public byte[] ToByteArray()\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var sizes = new int[__inputs.Count];\n");
+      out->Print("var size = global::Google.Protobuf.CodedOutputStream.ComputeInt32Size(__inputs.Count);\n");
+      out->Print("for (var i = 0; i < __inputs.Count; i++)\n");
+      out->Print("{\n");
+      out->Print("  sizes[i] = __inputs[i].CalculateSize();\n");
+      out->Print("  size += global::Google.Protobuf.CodedOutputStream.ComputeStringSize(__methodNames[i]) +\n");
+      out->Print("          global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(sizes[i]) + sizes[i];\n");
+      out->Print("}\n");
+      out->Print("var buffer = new byte[size];\n");
+      out->Print("var output = new global::Google.Protobuf.CodedOutputStream(buffer);\n");
+      out->Print("output.WriteInt32(__inputs.Count);\n");
+      out->Print("for (var i = 0; i < __inputs.Count; i++)\n");
+      out->Print("{\n");
+      out->Print("  output.WriteString(__methodNames[i]);\n");
+      out->Print("  output.WriteLength(sizes[i]);\n");
+      out->Print("  __inputs[i].WriteTo(output);\n");
+      out->Print("}\n");
+      out->Print("output.CheckNoSpaceLeft();\n");
+      out->Print("return buffer;\n");
+      out->Outdent();
+    }
+    out->Print("}\n\n");
+
+    out->Print("public void SetOutputs(byte[] outputs)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var input = new global::Google.Protobuf.CodedInputStream(outputs);\n");
+      out->Print("var results = new byte[__outputReaders.Count][];\n");
+      out->Print("for (var i = 0; i < results.Length; i++)\n");
+      out->Print("{\n");
+      out->Print("  results[i] = input.ReadBytes().ToByteArray();\n");
+      out->Print("}\n");
+      out->Print("if (!input.IsAtEnd)\n");
+      out->Print("{\n");
+      out->Print("  throw new global::System.InvalidOperationException(\"The batch results hold more than \" + results.Length + \" outputs.\");\n");
+      out->Print("}\n");
+      out->Print("for (var i = 0; i < results.Length; i++)\n");
+      out->Print("{\n");
+      out->Print("  __outputReaders[i](results[i]);\n");
+      out->Print("}\n");
+      out->Outdent();
+    }
+    out->Print("}\n\n");
+
+    out->Print("public async global::System.Threading.Tasks.Task ExecuteAsync(global::System.Func<byte[], global::System.Threading.Tasks.Task<byte[]>> send)\n");
+    out->Print("{\n");
+    out->Print("  SetOutputs(await send(ToByteArray()));\n");
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+}
+
+// Results are cached for the transaction the contract context of the state
+// is running, and dropped once another one runs. Cached outputs are cloned,
+// as messages are mutable.
+void GenerateViewMemoMembers(Printer* out, const FileModel& model,
+                             const ServiceModel& service_model, unsigned int flags) {
+  Methods methods;
+  for (int i = 0; i < service_model.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service_model, i);
+    if (method.is_view && GetMethodType(method.descriptor) == METHODTYPE_NO_STREAMING) {
+      methods.push_back(&method);
+    }
+  }
+  if (methods.empty()) {
+    return;
+  }
+
+  out->Print("\n");
+  out->Print("global::AElf.Types.Hash __memoTransactionId;\n");
+  for (size_t i = 0; i < methods.size(); i++) {
+    out->Print(
+        "readonly global::System.Collections.Generic.Dictionary<global::Google.Protobuf.ByteString, $response$> __$methodname$Memo = "
+        "new global::System.Collections.Generic.Dictionary<global::Google.Protobuf.ByteString, $response$>();\n",
+        "methodname", methods[i]->descriptor->name(),
+        "response", GetClassName(methods[i]->descriptor->output_type()));
+  }
+  out->Print("\n");
+
+  out->Print("void __ResetMemo()\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var transactionId = Context.TransactionId;\n");
+    out->Print("if (transactionId.Equals(__memoTransactionId))\n");
+    out->Print("{\n");
+    out->Print("  return;\n");
+    out->Print("}\n");
+    out->Print("__memoTransactionId = transactionId;\n");
+    for (size_t i = 0; i < methods.size(); i++) {
+      out->Print("__$methodname$Memo.Clear();\n",
+                 "methodname", methods[i]->descriptor->name());
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+
+  for (size_t i = 0; i < methods.size(); i++) {
+    std::map<grpc::string, grpc::string> vars;
+    vars["access_level"] = GetAccessLevel(flags);
+    vars["methodname"] = methods[i]->descriptor->name();
+    vars["request"] = GetClassName(methods[i]->descriptor->input_type());
+    vars["response"] = GetClassName(methods[i]->descriptor->output_type());
+    out->Print("\n");
+    out->Print(vars, "$access_level$ $response$ $methodname$Memoized($request$ input)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("__ResetMemo();\n");
+      out->Print("var key = global::Google.Protobuf.MessageExtensions.ToByteString(input);\n");
+      out->Print(vars, "if (!__$methodname$Memo.TryGetValue(key, out var output))\n");
+      out->Print("{\n");
+      out->Print(vars, "  output = $methodname$.Call(input);\n");
+      out->Print(vars, "  __$methodname$Memo[key] = output;\n");
+      out->Print("}\n");
+      out->Print("return output.Clone();\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+  }
+}
+
+std::string GetLocalInterfaceName(const ServiceDescriptor* service) {
+  return "I" + service->name() + "Local";
+}
+
+std::string GetLocalAdapterClassName(const ServiceDescriptor* service) {
+  return service->name() + "LocalAdapter";
+}
+
+// Only views are called directly: actions sent through a reference become
+// inline transactions, which have to go through the normal path.
+Methods GetLocalMethods(const FileModel& model, const ServiceModel& service) {
+  Methods methods;
+  for (int i = 0; i < service.full_method_count; i++) {
+    const MethodModel& method = GetFullMethod(model, service, i);
+    if (method.is_view && GetMethodType(method.descriptor) == METHODTYPE_NO_STREAMING) {
+      methods.push_back(&method);
+    }
+  }
+  return methods;
+}
+
+// The interface a host implements to run a referenced contract in process.
+// Along with the contract, an adapter implementing it over the contract base
+// is generated as well.
+void GenerateLocalInterface(Printer* out, const FileModel& model,
+                            const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  Methods methods = GetLocalMethods(model, service_model);
+  std::map<grpc::string, grpc::string> vars;
+  vars["access_level"] = GetAccessLevel(flags);
+  vars["interfacename"] = GetLocalInterfaceName(service);
+  vars["classname"] = GetLocalAdapterClassName(service);
+  vars["contractclass"] = GetServerClassName(service);
+  out->Print(vars, "$access_level$ interface $interfacename$\n");
+  out->Print("{\n");
+  for (size_t i = 0; i < methods.size(); i++) {
+    out->Print("  $response$ $methodname$($request$ input);\n",
+               "response", GetClassName(methods[i]->descriptor->output_type()),
+               "methodname", methods[i]->descriptor->name(),
+               "request", GetClassName(methods[i]->descriptor->input_type()));
+  }
+  out->Print("}\n");
+  out->Print("\n");
+  if (!NeedContract(flags)) {
+    return;
+  }
+  out->Print(vars, "public sealed class $classname$ : $interfacename$\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print(vars, "readonly $contractclass$ __contract;\n");
+    out->Print("\n");
+    out->Print(vars, "public $classname$($contractclass$ contract)\n");
+    out->Print("{\n");
+    out->Print("  __contract = contract;\n");
+    out->Print("}\n");
+    for (size_t i = 0; i < methods.size(); i++) {
+      out->Print("\n");
+      out->Print("public $response$ $methodname$($request$ input)\n",
+                 "response", GetClassName(methods[i]->descriptor->output_type()),
+                 "methodname", methods[i]->descriptor->name(),
+                 "request", GetClassName(methods[i]->descriptor->input_type()));
+      out->Print("{\n");
+      out->Print("  return __contract.$methodname$(input);\n",
+                 "methodname", methods[i]->descriptor->name());
+      out->Print("}\n");
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("\n");
+}
+
+// The host binds a local implementation to the reference state of the
+// contract calling it, for the address it runs the implementation for; the
+// binding lives and dies with that state. A reference to another address, and
+// any action, takes the normal path. Input and output are cloned so neither
+// contract sees the other's instances, the same as after a round trip through
+// bytes.
+void GenerateLocalReferenceMembers(Printer* out, const FileModel& model,
+                                   const ServiceModel& service_model, unsigned int flags) {
+  const ServiceDescriptor* service = service_model.descriptor;
+  Methods methods = GetLocalMethods(model, service_model);
+  std::map<grpc::string, grpc::string> vars;
+  vars["access_level"] = GetAccessLevel(flags);
+  vars["interfacename"] = GetLocalInterfaceName(service);
+  out->Print("\n");
+  out->Print("global::AElf.Types.Address __localAddress;\n");
+  out->Print(vars, "$interfacename$ __local;\n");
+  out->Print("\n");
+  out->Print(vars, "public void BindLocal(global::AElf.Types.Address address, $interfacename$ implementation)\n");
+  out->Print("{\n");
+  out->Print("  __localAddress = address;\n");
+  out->Print("  __local = implementation;\n");
+  out->Print("}\n");
+  out->Print("\n");
+  out->Print("public void UnbindLocal()\n");
+  out->Print("{\n");
+  out->Print("  __localAddress = null;\n");
+  out->Print("  __local = null;\n");
+  out->Print("}\n");
+  for (size_t i = 0; i < methods.size(); i++) {
+    vars["methodname"] = methods[i]->descriptor->name();
+    vars["request"] = GetClassName(methods[i]->descriptor->input_type());
+    vars["response"] = GetClassName(methods[i]->descriptor->output_type());
+    out->Print("\n");
+    out->Print(vars, "$access_level$ $response$ $methodname$Direct($request$ input)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("if (__local != null && Value != null && Value.Equals(__localAddress))\n");
+      out->Print("{\n");
+      out->Print(vars, "  return __local.$methodname$(input.Clone()).Clone();\n");
+      out->Print("}\n");
+      out->Print(vars, "return $methodname$.Call(input);\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+  }
+}
+
+  void GenerateReferenceClass(Printer* out, const FileModel& model,
+                              const ServiceModel& service_model, unsigned int flags) {
+    const ServiceDescriptor* service = service_model.descriptor;
+
+    // TODO: Maybe provide ContractReferenceState in options
+    out->Print("public class $classname$ : global::AElf.Sdk.CSharp.State.ContractReferenceState\n",
+               "classname", GetReferenceClassName(service));
+    out->Print("{\n");
+    {
+      out->Indent();
+      for (int i = 0; i < service_model.full_method_count; i++) {
+        const MethodModel& method_model = GetFullMethod(model, service_model, i);
+        const MethodDescriptor* method = method_model.descriptor;
+        out->Print("$access_level$ global::AElf.Sdk.CSharp.State.MethodReference<$request$, $response$> $fieldname$ { get; set; }\n",
+                   "access_level", GetAccessLevel(flags),
+                   "fieldname", method->name(),
+                   "request", GetClassName(method->input_type()),
+                   "response", GetClassName(method->output_type()));
+      }
+      if (NeedReferenceViewMemo(flags)) {
+        GenerateViewMemoMembers(out, model, service_model, flags);
+      }
+      if (NeedReferenceLocal(flags) && !GetLocalMethods(model, service_model).empty()) {
+        GenerateLocalReferenceMembers(out, model, service_model, flags);
+      }
+      out->Outdent();
+    }
+
+    out->Print("}\n");
+  }
+
+// The bits of the event name never change, so they are computed once per
+// event type; only the indexed fields are hashed for each fired event. Values
+// are added the way LogEvent.GetBloom adds them, the name as a StringValue.
+// The contract address is left to the caller, as it is not known to the event.
+void GenerateEventBloom(Printer* out, const FileModel& model,
+                        const EventModel& event){
+  const Descriptor* message = event.descriptor;
+  out->Print("static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();\n\n");
+  out->Print("static global::AElf.Types.Bloom __CreateNameBloom()\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var bloom = new global::AElf.Types.Bloom();\n");
+    out->Print("bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = \"$eventname$\" });\n",
+               "eventname", message->name());
+    out->Print("return bloom;\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+
+  out->Print("public global::AElf.Types.Bloom GetBloomBits()\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var bloom = new global::AElf.Types.Bloom();\n");
+    out->Print("bloom.Combine(__NameBloom);\n");
+    for(int i = 0; i < event.field_count; i++){
+      const FieldModel& field = GetEventField(model, event, i);
+      if(field.is_indexed){
+        out->Print("bloom.AddValue(new $classname$ { $propertyname$ = $propertyname$ });\n",
+                   "classname", message->name(),
+                   "propertyname", GetPropertyName(field.descriptor));
+      }
+    }
+    out->Print("return bloom;\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+}
+
+std::string GetEventWireClassName(const FileDescriptor* file) {
+  return grpc_generator::FileNameInUpperCamel(file, false) + "EventWire";
+}
+
+// Wire format primitives shared by the decoders of all events of the file.
+void GenerateEventWireClass(Printer* out, const FileDescriptor* file) {
+  out->Print("internal static class $classname$\n",
+             "classname", GetEventWireClassName(file));
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("internal static bool TryReadVarint(global::System.ReadOnlySpan<byte> data, ref int offset, out ulong value)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("value = 0;\n");
+      out->Print("for (var shift = 0; shift < 64 && offset < data.Length; shift += 7)\n");
+      out->Print("{\n");
+      out->Print("  var b = data[offset++];\n");
+      out->Print("  value |= (ulong) (b & 0x7F) << shift;\n");
+      out->Print("  if (b < 0x80)\n");
+      out->Print("  {\n");
+      out->Print("    return true;\n");
+      out->Print("  }\n");
+      out->Print("}\n");
+      out->Print("return false;\n");
+      out->Outdent();
+    }
+    out->Print("}\n\n");
+
+    // Reads one field and gets its value without the tag: the raw varint,
+    // the fixed size value or the payload of a length-delimited field.
+    out->Print("internal static bool TryReadField(global::System.ReadOnlySpan<byte> data, ref int offset, out uint tag, out global::System.ReadOnlySpan<byte> value)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("tag = 0;\n");
+      out->Print("value = default(global::System.ReadOnlySpan<byte>);\n");
+      out->Print("if (!TryReadVarint(data, ref offset, out var rawTag) || rawTag > uint.MaxValue)\n");
+      out->Print("{\n");
+      out->Print("  return false;\n");
+      out->Print("}\n");
+      out->Print("tag = (uint) rawTag;\n");
+      out->Print("var start = offset;\n");
+      out->Print("ulong length;\n");
+      out->Print("switch (tag & 7)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("case 0:\n");
+        out->Print("  if (!TryReadVarint(data, ref offset, out length))\n");
+        out->Print("  {\n");
+        out->Print("    return false;\n");
+        out->Print("  }\n");
+        out->Print("  value = data.Slice(start, offset - start);\n");
+        out->Print("  return true;\n");
+        out->Print("case 1:\n");
+        out->Print("  length = 8;\n");
+        out->Print("  break;\n");
+        out->Print("case 2:\n");
+        out->Print("  if (!TryReadVarint(data, ref offset, out length))\n");
+        out->Print("  {\n");
+        out->Print("    return false;\n");
+        out->Print("  }\n");
+        out->Print("  break;\n");
+        out->Print("case 5:\n");
+        out->Print("  length = 4;\n");
+        out->Print("  break;\n");
+        out->Print("default:\n");
+        out->Print("  return false;\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Print("if (length > (ulong) (data.Length - offset))\n");
+      out->Print("{\n");
+      out->Print("  return false;\n");
+      out->Print("}\n");
+      out->Print("value = data.Slice(offset, (int) length);\n");
+      out->Print("offset += (int) length;\n");
+      out->Print("return true;\n");
+      out->Outdent();
+    }
+    out->Print("}\n\n");
+
+    out->Print("internal static ulong ReadVarint(global::System.ReadOnlySpan<byte> value)\n");
+    out->Print("{\n");
+    out->Print("  var offset = 0;\n");
+    out->Print("  TryReadVarint(value, ref offset, out var result);\n");
+    out->Print("  return result;\n");
+    out->Print("}\n\n");
+    out->Print("internal static uint ReadFixed32(global::System.ReadOnlySpan<byte> value)\n");
+    out->Print("{\n");
+    out->Print("  return value.Length < 4 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt32LittleEndian(value);\n");
+    out->Print("}\n\n");
+    out->Print("internal static ulong ReadFixed64(global::System.ReadOnlySpan<byte> value)\n");
+    out->Print("{\n");
+    out->Print("  return value.Length < 8 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt64LittleEndian(value);\n");
+    out->Print("}\n\n");
+    out->Print("internal static int DecodeZigZag32(uint value)\n");
+    out->Print("{\n");
+    out->Print("  return (int) (value >> 1) ^ -(int) (value & 1);\n");
+    out->Print("}\n\n");
+    out->Print("internal static long DecodeZigZag64(ulong value)\n");
+    out->Print("{\n");
+    out->Print("  return (long) (value >> 1) ^ -(long) (value & 1);\n");
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+}
+
+// Gets the C# type of the view property of field and the expression decoding
+// it from the raw value in valuefield. Returns false for fields without a
+// view property.
+bool GetWireViewProperty(const FieldDescriptor* field, const std::string& wire,
+                         const std::string& valuefield, std::string* type,
+                         std::string* expression) {
+  if (field->is_repeated()) {
+    return false;
+  }
+  switch (field->type()) {
+    case FieldDescriptor::TYPE_INT32:
+      *type = "int";
+      *expression = "(int) " + wire + ".ReadVarint(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_INT64:
+      *type = "long";
+      *expression = "(long) " + wire + ".ReadVarint(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_UINT32:
+      *type = "uint";
+      *expression = "(uint) " + wire + ".ReadVarint(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_UINT64:
+      *type = "ulong";
+      *expression = wire + ".ReadVarint(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_SINT32:
+      *type = "int";
+      *expression = wire + ".DecodeZigZag32((uint) " + wire + ".ReadVarint(" + valuefield + "))";
+      return true;
+    case FieldDescriptor::TYPE_SINT64:
+      *type = "long";
+      *expression = wire + ".DecodeZigZag64(" + wire + ".ReadVarint(" + valuefield + "))";
+      return true;
+    case FieldDescriptor::TYPE_BOOL:
+      *type = "bool";
+      *expression = wire + ".ReadVarint(" + valuefield + ") != 0";
+      return true;
+    case FieldDescriptor::TYPE_ENUM:
+      *type = GetClassName(field->enum_type());
+      *expression = "(" + *type + ") (int) " + wire + ".ReadVarint(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_FIXED32:
+      *type = "uint";
+      *expression = wire + ".ReadFixed32(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_SFIXED32:
+      *type = "int";
+      *expression = "(int) " + wire + ".ReadFixed32(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_FLOAT:
+      *type = "float";
+      *expression = "global::System.BitConverter.Int32BitsToSingle((int) " + wire +
+                    ".ReadFixed32(" + valuefield + "))";
+      return true;
+    case FieldDescriptor::TYPE_FIXED64:
+      *type = "ulong";
+      *expression = wire + ".ReadFixed64(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_SFIXED64:
+      *type = "long";
+      *expression = "(long) " + wire + ".ReadFixed64(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_DOUBLE:
+      *type = "double";
+      *expression = "global::System.BitConverter.Int64BitsToDouble((long) " + wire +
+                    ".ReadFixed64(" + valuefield + "))";
+      return true;
+    case FieldDescriptor::TYPE_STRING:
+      *type = "string";
+      *expression = "global::System.Text.Encoding.UTF8.GetString(" + valuefield + ")";
+      return true;
+    case FieldDescriptor::TYPE_BYTES:
+    case FieldDescriptor::TYPE_MESSAGE:
+      // The encoded bytes or message, left to the caller to parse if needed.
+      *type = "global::System.ReadOnlySpan<byte>";
+      *expression = valuefield;
+      return true;
+    case FieldDescriptor::TYPE_GROUP:
+      return false;
+  }
+  return false;
+}
+
+// The decoder reads the fields of the event straight from the non-indexed
+// payload and the indexed topics, each of which is an instance of the event
+// with a single field set. The view only refers to the input, and the values
+// are decoded when the properties are read. Repeated and map fields are
+// skipped.
+void GenerateEventDecoder(Printer* out, const FileModel& model,
+                          const EventModel& event){
+  std::string wire = GetEventWireClassName(model.file);
+  out->Print("public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, "
+             "global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, "
+             "out WireView view)\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("view = new WireView();\n");
+    out->Print("if (!view.TryMerge(nonIndexed))\n");
+    out->Print("{\n");
+    out->Print("  return false;\n");
+    out->Print("}\n");
+    out->Print("for (var i = 0; i < indexed.Count; i++)\n");
+    out->Print("{\n");
+    out->Print("  if (!view.TryMerge(indexed[i].Span))\n");
+    out->Print("  {\n");
+    out->Print("    return false;\n");
+    out->Print("  }\n");
+    out->Print("}\n");
+    out->Print("return true;\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+
+  out->Print("public ref struct WireView\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    std::vector<const FieldDescriptor*> fields;
+    std::string type;
+    std::string expression;
+    for(int i = 0; i < event.field_count; i++){
+      const FieldDescriptor* field = GetEventField(model, event, i).descriptor;
+      if(GetWireViewProperty(field, wire, "", &type, &expression)){
+        fields.push_back(field);
+      }
+    }
+    for(size_t i = 0; i < fields.size(); i++){
+      out->Print("global::System.ReadOnlySpan<byte> __$name$;\n",
+                 "name", GetPropertyName(fields[i]));
+    }
+    out->Print("\n");
+    for(size_t i = 0; i < fields.size(); i++){
+      std::string valuefield = "__" + GetPropertyName(fields[i]);
+      GetWireViewProperty(fields[i], wire, valuefield, &type, &expression);
+      out->Print("public $type$ $name$ { get { return $expression$; } }\n",
+                 "type", type, "name", GetPropertyName(fields[i]),
+                 "expression", expression);
+      if(fields[i]->type() == FieldDescriptor::TYPE_STRING){
+        out->Print("public global::System.ReadOnlySpan<byte> $name$Utf8 { get { return $valuefield$; } }\n",
+                   "name", GetPropertyName(fields[i]), "valuefield", valuefield);
+      }
+    }
+    out->Print("\n");
+
+    out->Print("internal bool TryMerge(global::System.ReadOnlySpan<byte> data)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("var offset = 0;\n");
+      out->Print("while (offset < data.Length)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        out->Print("if (!$wire$.TryReadField(data, ref offset, out var tag, out var value))\n",
+                   "wire", wire);
+        out->Print("{\n");
+        out->Print("  return false;\n");
+        out->Print("}\n");
+        out->Print("switch (tag)\n");
+        out->Print("{\n");
+        {
+          out->Indent();
+          for(size_t i = 0; i < fields.size(); i++){
+            std::ostringstream tag;
+            tag << WireFormat::MakeTag(fields[i]);
+            out->Print("case $tag$:\n", "tag", tag.str());
+            out->Print("  __$name$ = value;\n", "name", GetPropertyName(fields[i]));
+            out->Print("  break;\n");
+          }
+          out->Outdent();
+        }
+        out->Print("}\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Print("return true;\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+}
+
+std::string GetCodedStreamTypeName(const FieldDescriptor* field) {
+  switch (field->type()) {
+    case FieldDescriptor::TYPE_DOUBLE: return "Double";
+    case FieldDescriptor::TYPE_FLOAT: return "Float";
+    case FieldDescriptor::TYPE_INT64: return "Int64";
+    case FieldDescriptor::TYPE_UINT64: return "UInt64";
+    case FieldDescriptor::TYPE_INT32: return "Int32";
+    case FieldDescriptor::TYPE_FIXED64: return "Fixed64";
+    case FieldDescriptor::TYPE_FIXED32: return "Fixed32";
+    case FieldDescriptor::TYPE_BOOL: return "Bool";
+    case FieldDescriptor::TYPE_STRING: return "String";
+    case FieldDescriptor::TYPE_MESSAGE: return "Message";
+    case FieldDescriptor::TYPE_BYTES: return "Bytes";
+    case FieldDescriptor::TYPE_UINT32: return "UInt32";
+    case FieldDescriptor::TYPE_ENUM: return "Enum";
+    case FieldDescriptor::TYPE_SFIXED32: return "SFixed32";
+    case FieldDescriptor::TYPE_SFIXED64: return "SFixed64";
+    case FieldDescriptor::TYPE_SINT32: return "SInt32";
+    case FieldDescriptor::TYPE_SINT64: return "SInt64";
+    default: return "";
+  }
+}
+
+// Singular fields are written straight from the event. Repeated fields and
+// wrapper types, which C# maps to nullable values, need the generated codecs.
+// So do scalars with explicit presence, proto2 fields and oneof members
+// including proto3 optional ones, which are written even when set to the
+// default value.
+bool IsDirectlyWritableField(const FieldDescriptor* field) {
+  if (field->is_repeated() || field->type() == FieldDescriptor::TYPE_GROUP) {
+    return false;
+  }
+  if (field->type() != FieldDescriptor::TYPE_MESSAGE &&
+      (field->file()->syntax() != FileDescriptor::SYNTAX_PROTO3 ||
+       field->containing_oneof() != NULL)) {
+    return false;
+  }
+  return field->type() != FieldDescriptor::TYPE_MESSAGE ||
+         field->message_type()->file()->name() != "google/protobuf/wrappers.proto";
+}
+
+// Prints the statements adding the encoded size of field in event e to size,
+// or writing it to output, the same way the generated WriteTo does.
+void PrintDirectFieldCode(Printer* out, const FieldDescriptor* field, bool write) {
+  std::map<grpc::string, grpc::string> vars;
+  std::ostringstream tag;
+  tag << WireFormat::MakeTag(field);
+  std::ostringstream tagsize;
+  tagsize << WireFormat::TagSize(field->number(), field->type());
+  vars["name"] = GetPropertyName(field);
+  vars["type"] = GetCodedStreamTypeName(field);
+  vars["tag"] = tag.str();
+  vars["tagsize"] = tagsize.str();
+  vars["value"] = field->type() == FieldDescriptor::TYPE_ENUM
+      ? "(int) e." + GetPropertyName(field) : "e." + GetPropertyName(field);
+  switch (field->type()) {
+    case FieldDescriptor::TYPE_MESSAGE:
+      out->Print(vars, "if (e.$name$ != null)\n");
+      break;
+    case FieldDescriptor::TYPE_STRING:
+    case FieldDescriptor::TYPE_BYTES:
+      out->Print(vars, "if (e.$name$.Length != 0)\n");
+      break;
+    case FieldDescriptor::TYPE_BOOL:
+      out->Print(vars, "if (e.$name$)\n");
+      break;
+    default:
+      out->Print(vars, "if (e.$name$ != 0)\n");
+      break;
+  }
+  out->Print("{\n");
+  if (write) {
+    out->Print(vars, "  output.WriteTag($tag$);\n");
+    out->Print(vars, "  output.Write$type$($value$);\n");
+  } else {
+    out->Print(vars, "  size += $tagsize$ + global::Google.Protobuf.CodedOutputStream.Compute$type$Size($value$);\n");
+  }
+  out->Print("}\n");
+}
+
+std::vector<const FieldDescriptor*> GetFieldsByNumber(const FileModel& model,
+                                                      const EventModel& event,
+                                                      bool indexed) {
+  std::vector<const FieldDescriptor*> fields;
+  for (int i = 0; i < event.field_count; i++) {
+    const FieldModel& field = GetEventField(model, event, i);
+    if (field.is_indexed == indexed) {
+      fields.push_back(field.descriptor);
+    }
+  }
+  std::sort(fields.begin(), fields.end(),
+            [](const FieldDescriptor* a, const FieldDescriptor* b) {
+              return a->number() < b->number();
+            });
+  return fields;
+}
+
+// Encodes a batch of events into one buffer: the sizes of all parts are
+// computed first, then every indexed part and non-indexed part is written in
+// a single pass and wrapped without copying. The bytes are the same as those
+// of GetIndexed and GetNonIndexed. ToLogEvents allocates the buffer and the
+// log events for the batch, which may then be kept. LogEventBatch reuses its
+// buffer and log events from one batch to the next, and hands each batch to
+// the sink in one call; the sink must be done with them when it returns.
+void GenerateEventBatch(Printer* out, const FileModel& model,
+                        const EventModel& event) {
+  const Descriptor* message = event.descriptor;
+  std::vector<const FieldDescriptor*> indexed = GetFieldsByNumber(model, event, true);
+  std::vector<const FieldDescriptor*> non_indexed = GetFieldsByNumber(model, event, false);
+  bool direct = true;
+  for (int i = 0; i < event.field_count; i++) {
+    direct = direct && IsDirectlyWritableField(GetEventField(model, event, i).descriptor);
+  }
+  std::map<grpc::string, grpc::string> vars;
+  std::ostringstream parts;
+  parts << indexed.size() + 1;
+  vars["classname"] = message->name();
+  vars["parts"] = parts.str();
+  vars["messages_param"] = direct ? "" : ", " + message->name() + "[] messages";
+  vars["messages_arg"] = direct ? "" : ", messages";
+  vars["batch_messages_arg"] = direct ? "" : ", __messages";
+
+  // Sizes of the parts; the parts themselves are kept in messages when the
+  // fields aren't written directly.
+  out->Print(vars, "static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<$classname$> events, int[] sizes$messages_param$)\n");
+  out->Print("{\n");
+  out->Indent();
+  out->Print("var total = 0;\n");
+  out->Print("for (var i = 0; i < events.Count; i++)\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("var e = events[i];\n");
+    if (direct) {
+      out->Print("int size;\n");
+      for (size_t j = 0; j <= indexed.size(); j++) {
+        std::ostringstream part;
+        part << j;
+        vars["part"] = part.str();
+        out->Print("size = 0;\n");
+        if (j < indexed.size()) {
+          PrintDirectFieldCode(out, indexed[j], false);
+        } else {
+          for (size_t k = 0; k < non_indexed.size(); k++) {
+            PrintDirectFieldCode(out, non_indexed[k], false);
+          }
+        }
+        out->Print(vars, "sizes[i * $parts$ + $part$] = size;\n");
+        out->Print("total += size;\n");
+      }
+    } else {
+      out->Print(vars, "var part = i * $parts$;\n");
+      out->Print("foreach (var indexed in e.GetIndexed())\n");
+      out->Print("{\n");
+      out->Print("  messages[part++] = indexed;\n");
+      out->Print("}\n");
+      out->Print("messages[part] = e.GetNonIndexed();\n");
+      out->Print(vars, "for (var j = i * $parts$; j <= part; j++)\n");
+      out->Print("{\n");
+      out->Print("  sizes[j] = messages[j].CalculateSize();\n");
+      out->Print("  total += sizes[j];\n");
+      out->Print("}\n");
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("return total;\n");
+  out->Outdent();
+  out->Print("}\n\n");
+
+  // Writes the parts at the start of buffer and sets them on the log events,
+  // creating the missing ones.
+  out->Print(vars, "static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<$classname$> events, global::AElf.Types.Address address, int[] sizes$messages_param$, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)\n");
+  out->Print("{\n");
+  out->Indent();
+  out->Print("var output = new global::Google.Protobuf.CodedOutputStream(buffer);\n");
+  out->Print("var offset = 0;\n");
+  out->Print("for (var i = 0; i < events.Count; i++)\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    if (direct) {
+      out->Print("var e = events[i];\n");
+    }
+    out->Print("var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());\n");
+    out->Print("logEvent.Address = address;\n");
+    out->Print(vars, "logEvent.Name = \"$classname$\";\n");
+    out->Print("logEvent.Indexed.Clear();\n");
+    for (size_t j = 0; j <= indexed.size(); j++) {
+      std::ostringstream part;
+      part << j;
+      vars["part"] = part.str();
+      if (direct && j < indexed.size()) {
+        PrintDirectFieldCode(out, indexed[j], true);
+      } else if (direct) {
+        for (size_t k = 0; k < non_indexed.size(); k++) {
+          PrintDirectFieldCode(out, non_indexed[k], true);
+        }
+      } else {
+        out->Print(vars, "messages[i * $parts$ + $part$].WriteTo(output);\n");
+      }
+      out->Print(vars, "var part$part$ = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap("
+                 "new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * $parts$ + $part$]));\n");
+      out->Print(vars, "offset += sizes[i * $parts$ + $part$];\n");
+      if (j < indexed.size()) {
+        out->Print(vars, "logEvent.Indexed.Add(part$part$);\n");
+      } else {
+        out->Print(vars, "logEvent.NonIndexed = part$part$;\n");
+      }
+    }
+    out->Outdent();
+  }
+  out->Print("}\n");
+  out->Print("if (output.Position != total)\n");
+  out->Print("{\n");
+  out->Print("  throw new global::System.InvalidOperationException(\"Log events written with a size different from the computed one.\");\n");
+  out->Print("}\n");
+  out->Outdent();
+  out->Print("}\n\n");
+
+  out->Print(vars, "public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<$classname$> events, global::AElf.Types.Address address)\n");
+  out->Print("{\n");
+  out->Indent();
+  out->Print(vars, "var sizes = new int[events.Count * $parts$];\n");
+  if (!direct) {
+    out->Print(vars, "var messages = new $classname$[events.Count * $parts$];\n");
+  }
+  out->Print(vars, "var total = __ComputeSizes(events, sizes$messages_arg$);\n");
+  out->Print("var logEvents = new global::AElf.Types.LogEvent[events.Count];\n");
+  out->Print(vars, "__WriteLogEvents(events, address, sizes$messages_arg$, total, new byte[total], logEvents);\n");
+  out->Print("return logEvents;\n");
+  out->Outdent();
+  out->Print("}\n\n");
+
+  out->Print("public sealed class LogEventBatch\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("int[] __sizes = new int[0];\n");
+    if (!direct) {
+      out->Print(vars, "$classname$[] __messages = new $classname$[0];\n");
+    }
+    out->Print("byte[] __buffer = new byte[0];\n");
+    out->Print("global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];\n");
+    out->Print("\n");
+    out->Print(vars, "public void Fire(global::System.Collections.Generic.IReadOnlyList<$classname$> events, global::AElf.Types.Address address,\n"
+               "    global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("if (__logEvents.Length < events.Count)\n");
+      out->Print("{\n");
+      out->Print("  global::System.Array.Resize(ref __logEvents, events.Count);\n");
+      out->Print(vars, "  __sizes = new int[events.Count * $parts$];\n");
+      if (!direct) {
+        out->Print(vars, "  __messages = new $classname$[events.Count * $parts$];\n");
+      }
+      out->Print("}\n");
+      out->Print(vars, "var total = __ComputeSizes(events, __sizes$batch_messages_arg$);\n");
+      out->Print("if (__buffer.Length < total)\n");
+      out->Print("{\n");
+      out->Print("  __buffer = new byte[total];\n");
+      out->Print("}\n");
+      out->Print(vars, "__WriteLogEvents(events, address, __sizes$batch_messages_arg$, total, __buffer, __logEvents);\n");
+      out->Print("sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n");
+}
+
+std::string GetEventRouterClassName(const FileDescriptor* file) {
+  return grpc_generator::FileNameInUpperCamel(file, false) + "EventRouter";
+}
+
+// Routes a log event to the handler of its type. The name is matched by a
+// string switch, which the C# compiler turns into a hash lookup, and the
+// event is only parsed once its type is known. Handlers are called through a
+// type parameter and passed by reference, so that struct handlers are neither
+// boxed nor copied, and the state they update is the caller's.
+void GenerateEventRouter(Printer* out, const FileModel& model, unsigned int flags) {
+  std::map<grpc::string, grpc::string> vars;
+  vars["access_level"] = GetAccessLevel(flags);
+  vars["classname"] = GetEventRouterClassName(model.file);
+  out->Print(vars, "$access_level$ static class $classname$\n");
+  out->Print("{\n");
+  {
+    out->Indent();
+    out->Print("public interface IHandler\n");
+    out->Print("{\n");
+    for (size_t i = 0; i < model.events.size(); i++) {
+      out->Print("  void On$eventname$($eventname$ eventData, global::AElf.Types.LogEvent logEvent);\n",
+                 "eventname", model.events[i].descriptor->name());
+    }
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public abstract class HandlerBase : IHandler\n");
+    out->Print("{\n");
+    for (size_t i = 0; i < model.events.size(); i++) {
+      out->Print("  public virtual void On$eventname$($eventname$ eventData, global::AElf.Types.LogEvent logEvent) {}\n",
+                 "eventname", model.events[i].descriptor->name());
+    }
+    out->Print("}\n");
+    out->Print("\n");
+    out->Print("public static bool Route<THandler>(global::AElf.Types.LogEvent logEvent, ref THandler handler)\n");
+    out->Print("    where THandler : IHandler\n");
+    out->Print("{\n");
+    {
+      out->Indent();
+      out->Print("switch (logEvent.Name)\n");
+      out->Print("{\n");
+      {
+        out->Indent();
+        for (size_t i = 0; i < model.events.size(); i++) {
+          vars["eventname"] = model.events[i].descriptor->name();
+          out->Print(vars, "case \"$eventname$\":\n");
+          out->Print("{\n");
+          out->Indent();
+          out->Print(vars, "var eventData = new $eventname$();\n");
+          out->Print("foreach (var indexed in logEvent.Indexed)\n");
+          out->Print("{\n");
+          out->Print("  global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);\n");
+          out->Print("}\n");
+          out->Print("global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);\n");
+          out->Print(vars, "handler.On$eventname$(eventData, logEvent);\n");
+          out->Print("return true;\n");
+          out->Outdent();
+          out->Print("}\n");
+        }
+        out->Print("default:\n");
+        out->Print("  return false;\n");
+        out->Outdent();
+      }
+      out->Print("}\n");
+      out->Outdent();
+    }
+    out->Print("}\n");
+    out->Outdent();
+  }
+  out->Print("}\n\n");
+}
+
+void GenerateEvent(Printer* out, const FileModel& model, const EventModel& event,
+                   unsigned int flags){
+  const Descriptor* message = event.descriptor;
+  out->Print("$access_level$ partial class $classname$ : aelf::IEvent<$classname$>\n",
+             "access_level", GetAccessLevel(flags),
+             "classname", message->name());
+  out->Print("{\n");
+  {
+    out->Indent();
+    // GetIndexed
     out->Print("public global::System.Collections.Generic.IEnumerable<$classname$> GetIndexed()\n",
                "classname", message->name());
     out->Print("{\n");
@@ -555,15 +2931,15 @@ void GenerateEvent(Printer* out, const Descriptor* message, char flags){
       out->Indent();
         out->Print("return new List<$classname$>\n", "classname", message->name());
         out->Print("{\n");
-      for(int i = 0; i < message->field_count(); i++){
-        const FieldDescriptor* field = message->field(i);
+      for(int i = 0; i < event.field_count; i++){
+        const FieldModel& field = GetEventField(model, event, i);
 
-          if(IsIndexedField(field)){
+          if(field.is_indexed){
           out->Print("new $classname$\n", "classname", message->name());
           out->Print("{\n");
           {
             out->Indent();
-            out->Print("$propertyname$ = $propertyname$\n", "propertyname", GetPropertyName(field));
+            out->Print("$propertyname$ = $propertyname$\n", "propertyname", GetPropertyName(field.descriptor));
             out->Outdent();
           }
           out->Print("},\n");
@@ -585,10 +2961,10 @@ void GenerateEvent(Printer* out, const Descriptor* message, char flags){
       out->Print("{\n");
       {
         out->Indent();
-        for(int i = 0; i < message->field_count(); i++){
-          const FieldDescriptor* field = message->field(i);
-          if(!IsIndexedField(field)){
-            out->Print("$propertyname$ = $propertyname$,\n", "propertyname", GetPropertyName(field));
+        for(int i = 0; i < event.field_count; i++){
+          const FieldModel& field = GetEventField(model, event, i);
+          if(!field.is_indexed){
+            out->Print("$propertyname$ = $propertyname$,\n", "propertyname", GetPropertyName(field.descriptor));
           }
         }
         out->Outdent();
@@ -597,135 +2973,573 @@ void GenerateEvent(Printer* out, const Descriptor* message, char flags){
       out->Outdent();
     }
     out->Print("}\n");
+
+    if (NeedEventBloom(flags)) {
+      out->Print("\n");
+      GenerateEventBloom(out, model, event);
+    }
+
+    if (NeedEventDecoder(flags)) {
+      out->Print("\n");
+      GenerateEventDecoder(out, model, event);
+    }
+
+    if (NeedEventBatch(flags)) {
+      out->Print("\n");
+      GenerateEventBatch(out, model, event);
+    }
     out->Outdent();
   }
 
   out->Print("}\n\n");
 }
 
-void GenerateContainer(Printer *out, const ServiceDescriptor *service, char flags) {
-  GenerateDocCommentBody(out, service);
-  out->Print("$access_level$ static partial class $containername$\n",
-             "access_level", GetAccessLevel(flags),
-             "containername", GetServiceContainerClassName(service));
-  out->Print("{\n");
-  out->Indent();
-  out->Print("static readonly string $servicenamefield$ = \"$servicename$\";\n",
-             "servicenamefield", GetServiceNameFieldName(), "servicename",
-             service->full_name());
-  out->Print("\n");
+// Kinds of sections of the generated file, used to break down its size.
+enum SectionKind {
+  SECTION_FILE,
+  SECTION_EVENTS,
+  SECTION_CONTAINER,
+  SECTION_BASE,
+  SECTION_STUB,
+  SECTION_REFERENCE
+};
+
+// A part of the generated file rendered into its own buffer at the given
+// indentation level. The file is the concatenation of its sections.
+struct Section {
+  SectionKind kind;
+  int indent;
+  std::function<void(Printer*)> generate;
+};
+
+void AddSection(std::vector<Section>* sections, SectionKind kind, int indent,
+                const std::function<void(Printer*)>& generate) {
+  Section section;
+  section.kind = kind;
+  section.indent = indent;
+  section.generate = generate;
+  sections->push_back(section);
+}
+
+grpc::string RenderSection(const Section& section) {
+  grpc::string output;
+  {
+    // Scope the output stream so it closes and finalizes output to the string.
+    StringOutputStream output_stream(&output);
+    Printer out(&output_stream, '$');
+    for (int i = 0; i < section.indent; i++) {
+      out.Indent();
+    }
+    section.generate(&out);
+  }
+  return output;
+}
 
-  GenerateMarshallerFields(out, service);
-  out->Print("#region Methods\n");
-  Methods methods = GetFullMethod(service);
-  for(Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
-    GenerateStaticMethodField(out, *itr);
+// Sections only read the model and descriptors and write to their own
+// buffer, so they can be rendered on any number of threads; the buffers are
+// concatenated in section order afterwards.
+void RenderSections(const std::vector<Section>& sections, int threads,
+                    std::vector<grpc::string>* outputs) {
+  outputs->resize(sections.size());
+  size_t worker_count = std::min<size_t>(std::max(threads, 1), sections.size());
+  if (worker_count <= 1) {
+    for (size_t i = 0; i < sections.size(); i++) {
+      (*outputs)[i] = RenderSection(sections[i]);
+    }
+    return;
   }
-  out->Print("#endregion\n");
-  out->Print("\n");
 
-  out->Print("#region Descriptors\n");
-  GenerateServiceDescriptorProperty(out, service);
-  out->Print("\n");
-  GenerateAllServiceDescriptorsProperty(out, service);
-  out->Print("#endregion\n");
-  out->Print("\n");
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < worker_count; i++) {
+    workers.push_back(std::thread([&sections, outputs, &next]() {
+      for (size_t j = next++; j < sections.size(); j = next++) {
+        (*outputs)[j] = RenderSection(sections[j]);
+      }
+    }));
+  }
+  for (size_t i = 0; i < workers.size(); i++) {
+    workers[i].join();
+  }
+}
+
+void AddContainerSections(std::vector<Section>* sections,
+                          const FileModel& model, const ServiceModel& service,
+                          unsigned int flags, int indent) {
+  AddSection(sections, SECTION_CONTAINER, indent, [&model, &service, flags](Printer* out) {
+    GenerateDocCommentBody(out, service.descriptor);
+    out->Print("$access_level$ static partial class $containername$\n",
+               "access_level", GetAccessLevel(flags),
+               "containername", GetServiceContainerClassName(service.descriptor));
+    out->Print("{\n");
+    out->Indent();
+    // A constant doesn't trigger the type initializer of the container.
+    out->Print("$modifier$ $servicenamefield$ = \"$servicename$\";\n",
+               "modifier", NeedLazyInit(flags) ? "const string" : "static readonly string",
+               "servicenamefield", GetServiceNameFieldName(), "servicename",
+               service.descriptor->full_name());
+    out->Print("\n");
+  });
+
+  AddSection(sections, SECTION_CONTAINER, indent + 1, [&model, &service, flags](Printer* out) {
+    GenerateMarshallerFields(out, model, service, flags);
+  });
+
+  AddSection(sections, SECTION_CONTAINER, indent + 1, [&model, &service, flags](Printer* out) {
+    out->Print("#region Methods\n");
+    Methods methods = GetContainerMethods(model, service, flags);
+    for(Methods::iterator itr = methods.begin(); itr != methods.end(); ++itr) {
+      GenerateStaticMethodField(out, service, **itr, flags);
+    }
+    out->Print("#endregion\n");
+    out->Print("\n");
+  });
+
+  AddSection(sections, SECTION_CONTAINER, indent + 1, [&model, &service, flags](Printer* out) {
+    out->Print("#region Descriptors\n");
+    if (NeedEmbeddedDescriptor(flags)) {
+      GenerateEmbeddedDescriptorData(out, model, service);
+    }
+    GenerateServiceDescriptorProperty(out, model, service, flags);
+    out->Print("\n");
+    GenerateAllServiceDescriptorsProperty(out, model, service, flags);
+    out->Print("#endregion\n");
+    out->Print("\n");
+  });
+
+  if (HasMethodFee(model, service)) {
+    AddSection(sections, SECTION_CONTAINER, indent + 1, [&model, &service, flags](Printer* out) {
+      out->Print("#region Fees\n");
+      GenerateMethodFeeTable(out, model, service, flags);
+      out->Print("#endregion\n");
+      out->Print("\n");
+    });
+  }
 
   if (NeedContract(flags)) {
-    GenerateContractBaseClass(out, service);
-    GenerateBindServiceMethod(out, service);
+    if (NeedInstrument(flags)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service](Printer* out) {
+        GenerateInstrumentation(out, model, service);
+      });
+    }
+    if (NeedPoolInput(flags) && !GetPooledInputs(model, service).empty()) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service](Printer* out) {
+        GenerateInputPool(out, model, service);
+      });
+    }
+    if (NeedChunkedInput(flags) && HasChunkedMethod(model, service)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [](Printer* out) {
+        GenerateChunkedInput(out);
+      });
+    }
+    AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+      GenerateContractBaseClass(out, model, service, flags);
+    });
+    AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+      GenerateBindServiceMethod(out, model, service, flags);
+    });
+    if (NeedExecuteBatch(flags)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+        GenerateExecuteBatchMethod(out, model, service, flags);
+      });
+    }
+    if (NeedDirectStub(flags)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+        GenerateDirectStubClass(out, model, service, flags);
+      });
+    }
+    if (NeedBenchmark(flags)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+        GenerateBenchmarkClass(out, model, service, flags);
+      });
+    }
+    if (NeedReplay(flags)) {
+      AddSection(sections, SECTION_BASE, indent + 1, [&model, &service, flags](Printer* out) {
+        GenerateReplayClass(out, model, service, flags);
+      });
+    }
+  }
+
+  if (NeedLocalInterface(flags) && !GetLocalMethods(model, service).empty()) {
+    AddSection(sections, NeedContract(flags) ? SECTION_BASE : SECTION_REFERENCE, indent + 1,
+               [&model, &service, flags](Printer* out) {
+      GenerateLocalInterface(out, model, service, flags);
+    });
   }
 
-  if(NeedStub(flags)) {
-    GenerateStubClass(out, service);
+  if (NeedStub(flags)) {
+    AddSection(sections, SECTION_STUB, indent + 1, [&model, &service, flags](Printer* out) {
+      if(NeedStubTransactionTemplate(flags)) {
+        GenerateTransactionTemplateClass(out);
+      }
+
+      GenerateStubClass(out, model, service, flags);
+
+      if(NeedStubBatch(flags)) {
+        out->Print("\n");
+        GenerateBatchCallClass(out);
+        GenerateStubBatchClass(out, model, service, flags);
+      }
+    });
   }
 
   if(NeedReference(flags)){
-    GenerateReferenceClass(out, service, flags);
+    AddSection(sections, SECTION_REFERENCE, indent + 1, [&model, &service, flags](Printer* out) {
+      GenerateReferenceClass(out, model, service, flags);
+    });
+  }
+
+  AddSection(sections, SECTION_CONTAINER, indent, [](Printer* out) {
+    out->Print("}\n");
+  });
+}
+
+void CollectStats(const FileModel& model, unsigned int flags,
+                  const std::vector<Section>& sections,
+                  const std::vector<grpc::string>& outputs,
+                  GeneratorStats* stats) {
+  *stats = GeneratorStats();
+  stats->services = model.file_service_count;
+  for (int i = 0; i < model.file_service_count; i++) {
+    const ServiceModel& service = GetFileService(model, i);
+    stats->methods += service.full_method_count;
+    if (NeedContainer(flags) && !NeedSharedMarshallers(model.file)) {
+      stats->marshallers += GetUsedMessages(model, service, flags).size();
+    }
+    stats->base_depth = std::max(stats->base_depth, service.base_depth);
+  }
+  if (NeedContainer(flags) && NeedSharedMarshallers(model.file)) {
+    stats->marshallers = GetUsedMessages(model, flags).size();
+  }
+  stats->events = model.events.size();
+  for (size_t i = 0; i < model.events.size(); i++) {
+    stats->indexed_fields += model.events[i].indexed_field_count;
+  }
+  for (size_t i = 0; i < sections.size(); i++) {
+    size_t bytes = outputs[i].size();
+    stats->total_bytes += bytes;
+    switch (sections[i].kind) {
+      case SECTION_FILE:
+        break;
+      case SECTION_EVENTS:
+        stats->events_bytes += bytes;
+        break;
+      case SECTION_CONTAINER:
+        stats->container_bytes += bytes;
+        break;
+      case SECTION_BASE:
+        stats->base_bytes += bytes;
+        break;
+      case SECTION_STUB:
+        stats->stub_bytes += bytes;
+        break;
+      case SECTION_REFERENCE:
+        stats->reference_bytes += bytes;
+        break;
+    }
   }
-  out->Outdent();
-  out->Print("}\n");
 }
 
 }  // anonymous namespace
 
-grpc::string GetServices(const FileDescriptor* file, char flags) {
+grpc::string GetServices(const FileDescriptor* file, unsigned int flags,
+                         GeneratorStats* stats, int threads) {
   grpc::string output;
-  {
-    // Scope the output stream so it closes and finalizes output to the string.
-
-    StringOutputStream output_stream(&output);
-    Printer out(&output_stream, '$');
 
-    // Don't write out any output if there no services, to avoid empty service
-    // files being generated for proto files that don't declare any.
-    if (file->service_count() == 0) {
-      return output;
-    }
+  // Don't write out any output if there no services, to avoid empty service
+  // files being generated for proto files that don't declare any.
+  if (file->service_count() == 0) {
+    return output;
+  }
 
-    if(file->service_count() > 1){
-      GOOGLE_LOG(ERROR) << file->name() << ": File contains more than one service.";
-    }
+  // Don't write out any output if there no event for event-only generation
+  // scenario, this is usually for base contracts
+  FileModel model = BuildFileModel(file);
+  if(NeedOnlyEvent(flags) && model.events.empty()) {
+    return output;
+  }
 
-    // Don't write out any output if there no event for event-only generation
-    // scenario, this is usually for base contracts
-    if(NeedOnlyEvent(flags) && !HasEvent(file)) {
-      return output;
-    }
+  std::vector<Section> sections;
+  grpc::string file_namespace = GetFileNamespace(file);
+  int indent = file_namespace != "" ? 1 : 0;
 
+  AddSection(&sections, SECTION_FILE, 0, [file, file_namespace](Printer* out) {
     // Write out a file header.
-    out.Print("// <auto-generated>\n");
-    out.Print(
+    out->Print("// <auto-generated>\n");
+    out->Print(
         "//     Generated by the protocol buffer compiler.  DO NOT EDIT!\n");
-    out.Print("//     source: $filename$\n", "filename", file->name());
-    out.Print("// </auto-generated>\n");
+    out->Print("//     source: $filename$\n", "filename", file->name());
+    out->Print("// </auto-generated>\n");
 
     // use C++ style as there are no file-level XML comments in .NET
     grpc::string leading_comments = GetCsharpComments(file, true);
     if (!leading_comments.empty()) {
-      out.Print("// Original file comments:\n");
-      out.PrintRaw(leading_comments.c_str());
+      out->Print("// Original file comments:\n");
+      out->PrintRaw(leading_comments.c_str());
     }
 
-    out.Print("#pragma warning disable 0414, 1591\n");
+    out->Print("#pragma warning disable 0414, 1591\n");
 
-    out.Print("#region Designer generated code\n");
-    out.Print("\n");
-    out.Print("using System.Collections.Generic;\n");
-    out.Print("using aelf = global::AElf.CSharp.Core;\n");
-    out.Print("\n");
+    out->Print("#region Designer generated code\n");
+    out->Print("\n");
+    out->Print("using System.Collections.Generic;\n");
+    out->Print("using aelf = global::AElf.CSharp.Core;\n");
+    out->Print("\n");
 
-    grpc::string file_namespace = GetFileNamespace(file);
     if (file_namespace != "") {
-      out.Print("namespace $namespace$ {\n", "namespace", file_namespace);
-      out.Indent();
+      out->Print("namespace $namespace$ {\n", "namespace", file_namespace);
     }
-
-    if(NeedEvent(flags)){
-      // Events are not needed for contract reference
-      out.Print("\n");
-      out.Print("#region Events\n");
-      for(int i = 0; i < file->message_type_count(); i++){
-        const Descriptor* message = file->message_type(i);
-        GenerateEvent(&out, message, flags);
+  });
+
+  if(NeedEvent(flags)){
+    // Events are not needed for contract reference
+    AddSection(&sections, SECTION_EVENTS, indent, [&model, flags](Printer* out) {
+      out->Print("\n");
+      out->Print("#region Events\n");
+      if(NeedEventDecoder(flags) && !model.events.empty()){
+        GenerateEventWireClass(out, model.file);
       }
-      out.Print("#endregion\n");
-    }
-
-    if(NeedContainer(flags)){
-      for (int i = 0; i < file->service_count(); i++) {
-        GenerateContainer(&out, file->service(i), flags);
+      for(size_t i = 0; i < model.events.size(); i++){
+        GenerateEvent(out, model, model.events[i], flags);
+      }
+      if(NeedEventRouter(flags) && !model.events.empty()){
+        GenerateEventRouter(out, model, flags);
       }
+      out->Print("#endregion\n");
+    });
+  }
+
+  if(NeedContainer(flags)){
+    if (NeedSharedMarshallers(file)) {
+      AddSection(&sections, SECTION_CONTAINER, indent, [&model, flags](Printer* out) {
+        GenerateSharedMarshallersClass(out, model, flags);
+      });
     }
+    for (int i = 0; i < model.file_service_count; i++) {
+      AddContainerSections(&sections, model, GetFileService(model, i), flags, indent);
+    }
+  }
 
+  AddSection(&sections, SECTION_FILE, 0, [file_namespace](Printer* out) {
     if (file_namespace != "") {
-      out.Outdent();
-      out.Print("}\n");
+      out->Print("}\n");
     }
-    out.Print("#endregion\n");
-    out.Print("\n");
+    out->Print("#endregion\n");
+    out->Print("\n");
+  });
+
+  std::vector<grpc::string> outputs;
+  RenderSections(sections, threads, &outputs);
+  for (size_t i = 0; i < outputs.size(); i++) {
+    output += outputs[i];
+  }
+
+  if (stats != NULL) {
+    CollectStats(model, flags, sections, outputs, stats);
   }
   return output;
 }
 
+namespace {
+
+// Quotes value as a JSON string. Bytes from 0x80 up are copied, so UTF-8
+// names stay readable.
+grpc::string GetJsonString(const grpc::string& value) {
+  std::ostringstream json;
+  json << '"';
+  for (size_t i = 0; i < value.size(); i++) {
+    unsigned char c = static_cast<unsigned char>(value[i]);
+    switch (c) {
+      case '"': json << "\\\""; break;
+      case '\\': json << "\\\\"; break;
+      case '\b': json << "\\b"; break;
+      case '\f': json << "\\f"; break;
+      case '\n': json << "\\n"; break;
+      case '\r': json << "\\r"; break;
+      case '\t': json << "\\t"; break;
+      default:
+        if (c < 0x20) {
+          static const char hex[] = "0123456789abcdef";
+          json << "\\u00" << hex[c >> 4] << hex[c & 0xF];
+        } else {
+          json << value[i];
+        }
+    }
+  }
+  json << '"';
+  return json.str();
+}
+
+}  // anonymous namespace
+
+grpc::string GetStatsReport(const FileDescriptor* file,
+                            const GeneratorStats& stats) {
+  std::ostringstream report;
+  report << "{\n"
+         << "  \"source\": " << GetJsonString(file->name()) << ",\n"
+         << "  \"services\": " << stats.services << ",\n"
+         << "  \"methods\": " << stats.methods << ",\n"
+         << "  \"marshallers\": " << stats.marshallers << ",\n"
+         << "  \"events\": " << stats.events << ",\n"
+         << "  \"indexed_fields\": " << stats.indexed_fields << ",\n"
+         << "  \"base_depth\": " << stats.base_depth << ",\n"
+         << "  \"bytes\": {\n"
+         << "    \"events\": " << stats.events_bytes << ",\n"
+         << "    \"container\": " << stats.container_bytes << ",\n"
+         << "    \"base\": " << stats.base_bytes << ",\n"
+         << "    \"stub\": " << stats.stub_bytes << ",\n"
+         << "    \"reference\": " << stats.reference_bytes << ",\n"
+         << "    \"total\": " << stats.total_bytes << "\n"
+         << "  }\n"
+         << "}\n";
+  return report.str();
+}
+
+
+namespace {
+
+// Writes the ABI manifest. All integers are little-endian uint32, and all
+// strings are (offset, length) pairs into the string table at the end.
+grpc::string Base64Encode(const grpc::string& data) {
+  static const char kAlphabet[] =
+      "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  grpc::string encoded;
+  encoded.reserve((data.size() + 2) / 3 * 4);
+  for (size_t i = 0; i < data.size(); i += 3) {
+    google::protobuf::uint32 chunk = static_cast<unsigned char>(data[i]) << 16;
+    if (i + 1 < data.size()) {
+      chunk |= static_cast<unsigned char>(data[i + 1]) << 8;
+    }
+    if (i + 2 < data.size()) {
+      chunk |= static_cast<unsigned char>(data[i + 2]);
+    }
+    encoded += kAlphabet[(chunk >> 18) & 0x3F];
+    encoded += kAlphabet[(chunk >> 12) & 0x3F];
+    encoded += i + 1 < data.size() ? kAlphabet[(chunk >> 6) & 0x3F] : '=';
+    encoded += i + 2 < data.size() ? kAlphabet[chunk & 0x3F] : '=';
+  }
+  return encoded;
+}
+
+class AbiWriter {
+ public:
+  void WriteUInt32(google::protobuf::uint32 value) {
+    for (int i = 0; i < 4; i++) {
+      records_.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  }
+
+  void WriteString(const grpc::string& value) {
+    std::map<grpc::string, google::protobuf::uint32>::iterator found = offsets_.find(value);
+    google::protobuf::uint32 offset;
+    if (found != offsets_.end()) {
+      offset = found->second;
+    } else {
+      offset = strings_.size();
+      offsets_[value] = offset;
+      strings_ += value;
+    }
+    WriteUInt32(offset);
+    WriteUInt32(value.size());
+  }
+
+  size_t records_size() const { return records_.size(); }
+
+  // The manifest travels through protoc as the content of an output file,
+  // a proto string field that must hold valid UTF-8, so it's base64 encoded.
+  grpc::string Finish() const { return Base64Encode(records_ + strings_); }
+
+ private:
+  grpc::string records_;
+  grpc::string strings_;
+  std::map<grpc::string, google::protobuf::uint32> offsets_;
+};
+
+}  // anonymous namespace
+
+// Layout, once base64 decoded:
+//   header:  magic "AABI", version, service, method, event and field
+//            counts, string table offset
+//   service: name, first method, method count
+//   method:  name, input type, output type, flags (1 view, 2 client
+//            streaming, 4 server streaming)
+//   event:   name, first field, field count
+//   field:   name, number, type (FieldDescriptor::Type), type name (full
+//            name of the message or enum, empty for scalars), flags
+//            (1 indexed, 2 repeated)
+// Methods are those of the flattened services, in GetFullMethod order.
+grpc::string GetAbiManifest(const FileDescriptor* file) {
+  FileModel model = BuildFileModel(file);
+  int method_count = 0;
+  for (int i = 0; i < model.file_service_count; i++) {
+    method_count += GetFileService(model, i).full_method_count;
+  }
+
+  AbiWriter writer;
+  writer.WriteUInt32(0x49424141);  // "AABI"
+  writer.WriteUInt32(2);
+  writer.WriteUInt32(model.file_service_count);
+  writer.WriteUInt32(method_count);
+  writer.WriteUInt32(model.events.size());
+  writer.WriteUInt32(model.fields.size());
+  // The string table follows the fixed size records.
+  const int kHeaderSize = 7 * 4;
+  const int kServiceSize = 4 * 4;
+  const int kMethodSize = 7 * 4;
+  const int kEventSize = 4 * 4;
+  const int kFieldSize = 7 * 4;
+  writer.WriteUInt32(kHeaderSize + model.file_service_count * kServiceSize +
+                     method_count * kMethodSize +
+                     model.events.size() * kEventSize +
+                     model.fields.size() * kFieldSize);
+
+  int first_method = 0;
+  for (int i = 0; i < model.file_service_count; i++) {
+    const ServiceModel& service = GetFileService(model, i);
+    writer.WriteString(service.descriptor->full_name());
+    writer.WriteUInt32(first_method);
+    writer.WriteUInt32(service.full_method_count);
+    first_method += service.full_method_count;
+  }
+  for (int i = 0; i < model.file_service_count; i++) {
+    const ServiceModel& service = GetFileService(model, i);
+    for (int j = 0; j < service.full_method_count; j++) {
+      const MethodModel& method = GetFullMethod(model, service, j);
+      writer.WriteString(method.descriptor->name());
+      writer.WriteString(method.descriptor->input_type()->full_name());
+      writer.WriteString(method.descriptor->output_type()->full_name());
+      writer.WriteUInt32((method.is_view ? 1 : 0) |
+                         (method.descriptor->client_streaming() ? 2 : 0) |
+                         (method.descriptor->server_streaming() ? 4 : 0));
+    }
+  }
+  for (size_t i = 0; i < model.events.size(); i++) {
+    const EventModel& event = model.events[i];
+    writer.WriteString(event.descriptor->full_name());
+    writer.WriteUInt32(event.first_field);
+    writer.WriteUInt32(event.field_count);
+  }
+  for (size_t i = 0; i < model.fields.size(); i++) {
+    const FieldModel& field = model.fields[i];
+    writer.WriteString(field.descriptor->name());
+    writer.WriteUInt32(field.descriptor->number());
+    writer.WriteUInt32(field.descriptor->type());
+    if (field.descriptor->message_type() != NULL) {
+      writer.WriteString(field.descriptor->message_type()->full_name());
+    } else if (field.descriptor->enum_type() != NULL) {
+      writer.WriteString(field.descriptor->enum_type()->full_name());
+    } else {
+      writer.WriteString("");
+    }
+    writer.WriteUInt32((field.is_indexed ? 1 : 0) |
+                       (field.descriptor->is_repeated() ? 2 : 0));
+  }
+  GOOGLE_CHECK_EQ(writer.records_size(),
+                  static_cast<size_t>(kHeaderSize + model.file_service_count * kServiceSize +
+                                      method_count * kMethodSize +
+                                      model.events.size() * kEventSize +
+                                      model.fields.size() * kFieldSize));
+  return writer.Finish();
+}
+
 }  // namespace grpc_contract_csharp_generator
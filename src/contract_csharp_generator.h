@@ -26,17 +26,62 @@
 
 namespace grpc_contract_csharp_generator {
 
-  const unsigned char GENERATE_CONTRACT = 0x1; // hex for 0000 0001
-  const unsigned char GENERATE_STUB = 0x2; // hex for 0000 0010
-  const unsigned char GENERATE_REFERENCE = 0x4; // hex for 0000 0100
-  const unsigned char GENERATE_EVENT = 0x8; // hex for 0000 1000
-  const unsigned char INTERNAL_ACCESS = 0x80; // hex for 1000 0000
-  const unsigned char GENERATE_CONTRACT_WITH_EVENT = GENERATE_CONTRACT | GENERATE_EVENT;
-  const unsigned char GENERATE_STUB_WITH_EVENT = GENERATE_STUB | GENERATE_EVENT;
+  const unsigned int GENERATE_CONTRACT = 0x1; // hex for 0000 0001
+  const unsigned int GENERATE_STUB = 0x2; // hex for 0000 0010
+  const unsigned int GENERATE_REFERENCE = 0x4; // hex for 0000 0100
+  const unsigned int GENERATE_EVENT = 0x8; // hex for 0000 1000
+  const unsigned int EMBEDDED_DESCRIPTOR = 0x10; // hex for 0001 0000
+  const unsigned int GENERATE_STUB_BATCH = 0x20; // hex for 0010 0000
+  const unsigned int GENERATE_EVENT_BLOOM = 0x40; // hex for 0100 0000
+  const unsigned int INTERNAL_ACCESS = 0x80; // hex for 1000 0000
+  const unsigned int GENERATE_STUB_VALUE_TASK = 0x100; // hex for 0001 0000 0000
+  const unsigned int REUSE_BASE_CONTAINER = 0x200; // hex for 0010 0000 0000
+  const unsigned int LAZY_STATIC_INIT = 0x400; // hex for 0100 0000 0000
+  const unsigned int GENERATE_EVENT_DECODER = 0x800; // hex for 1000 0000 0000
+  const unsigned int GENERATE_BENCHMARK = 0x1000; // hex for 0001 0000 0000 0000
+  const unsigned int INSTRUMENT_CONTRACT = 0x2000; // hex for 0010 0000 0000 0000
+  const unsigned int GENERATE_DIRECT_STUB = 0x4000; // hex for 0100 0000 0000 0000
+  const unsigned int GENERATE_STUB_TX_TEMPLATE = 0x8000; // hex for 1000 0000 0000 0000
+  const unsigned int GENERATE_REFERENCE_VIEW_MEMO = 0x10000; // hex for 0001 0000 0000 0000 0000
+  const unsigned int POOL_CONTRACT_INPUT = 0x20000; // hex for 0010 0000 0000 0000 0000
+  const unsigned int GENERATE_EVENT_BATCH = 0x40000; // hex for 0100 0000 0000 0000 0000
+  const unsigned int CHUNKED_STREAM_INPUT = 0x80000; // hex for 1000 0000 0000 0000 0000
+  const unsigned int GENERATE_EVENT_ROUTER = 0x100000; // hex for 0001 0000 0000 0000 0000 0000
+  const unsigned int GENERATE_REFERENCE_LOCAL = 0x200000; // hex for 0010 0000 0000 0000 0000 0000
+  const unsigned int GENERATE_REPLAY = 0x400000; // hex for 0100 0000 0000 0000 0000 0000
+  const unsigned int GENERATE_CONTRACT_WITH_EVENT = GENERATE_CONTRACT | GENERATE_EVENT;
+  const unsigned int GENERATE_STUB_WITH_EVENT = GENERATE_STUB | GENERATE_EVENT;
 
   // reference doesn't require event
 
-  grpc::string GetServices(const grpc::protobuf::FileDescriptor *file, const char flags);
+  // Size and complexity figures of a generated file.
+  struct GeneratorStats {
+    int services = 0;
+    int methods = 0;
+    int marshallers = 0;
+    int events = 0;
+    int indexed_fields = 0;
+    int base_depth = 0;
+    size_t events_bytes = 0;
+    size_t container_bytes = 0;
+    size_t base_bytes = 0;
+    size_t stub_bytes = 0;
+    size_t reference_bytes = 0;
+    size_t total_bytes = 0;
+  };
+
+  // Sections of the file are rendered on up to threads threads; the output
+  // doesn't depend on the number of threads.
+  grpc::string GetServices(const grpc::protobuf::FileDescriptor *file, unsigned int flags,
+                           GeneratorStats* stats = NULL, int threads = 1);
+
+  // Gets a JSON report of the stats collected while generating file.
+  grpc::string GetStatsReport(const grpc::protobuf::FileDescriptor *file,
+                              const GeneratorStats& stats);
+
+  // Gets a base64 encoded binary manifest of the methods and events of file,
+  // readable without loading the generated assembly.
+  grpc::string GetAbiManifest(const grpc::protobuf::FileDescriptor *file);
 
 }  // namespace grpc_contract_csharp_generator
 
@@ -31,6 +31,20 @@ inline bool ServicesFilename(const grpc::protobuf::FileDescriptor* file,
   return true;
 }
 
+inline bool StatsFilename(const grpc::protobuf::FileDescriptor* file,
+                          grpc::string* file_name_or_error) {
+  *file_name_or_error =
+      grpc_generator::FileNameInUpperCamel(file, false) + ".c.stats.json";
+  return true;
+}
+
+inline bool AbiFilename(const grpc::protobuf::FileDescriptor* file,
+                        grpc::string* file_name_or_error) {
+  *file_name_or_error =
+      grpc_generator::FileNameInUpperCamel(file, false) + ".c.abi.b64";
+  return true;
+}
+
 // Get leading or trailing comments in a string. Comment lines start with "// ".
 // Leading detached comments are put in front of leading comments.
 template <typename DescriptorType>
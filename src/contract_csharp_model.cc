@@ -0,0 +1,271 @@
+/*
+ *
+ * Copyright 2015 gRPC authors. Modified by AElfProject.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdlib>
+#include <map>
+#include <set>
+#include <google/protobuf/stubs/logging.h>
+
+#include "contract_csharp_model.h"
+#include "aelf_options.pb.h"
+
+using grpc::protobuf::Descriptor;
+using grpc::protobuf::FieldDescriptor;
+using grpc::protobuf::FileDescriptor;
+using grpc::protobuf::MethodDescriptor;
+using grpc::protobuf::ServiceDescriptor;
+
+namespace grpc_contract_csharp_generator {
+namespace {
+
+typedef std::map<std::string, std::vector<int> > ServiceIndex;
+
+// Token symbols are upper case letters and digits.
+bool IsValidSymbol(const std::string& symbol) {
+  if (symbol.empty()) {
+    return false;
+  }
+  for (size_t i = 0; i < symbol.size(); i++) {
+    if (!(symbol[i] >= 'A' && symbol[i] <= 'Z') && !(symbol[i] >= '0' && symbol[i] <= '9')) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Resource weights are given as "SYMBOL=weight", the weight being a
+// non-negative 64-bit integer.
+void AddResourceWeights(FileModel* model, MethodModel* method_model) {
+  const MethodDescriptor* method = method_model->descriptor;
+  method_model->first_resource_weight = model->resource_weights.size();
+  int weightCount = method->options().ExtensionSize(aelf::resource_weight);
+  for (int i = 0; i < weightCount; i++) {
+    std::string weight = method->options().GetExtension(aelf::resource_weight, i);
+    size_t separator = weight.find('=');
+    char* end = NULL;
+    bool valid = false;
+    ResourceWeightModel weight_model = ResourceWeightModel();
+    // strtoll would also take signs and leading spaces, so a digit must follow.
+    if (separator != std::string::npos && separator + 1 < weight.size() &&
+        weight[separator + 1] >= '0' && weight[separator + 1] <= '9') {
+      weight_model.symbol = weight.substr(0, separator);
+      errno = 0;
+      weight_model.weight = strtoll(weight.c_str() + separator + 1, &end, 10);
+      valid = IsValidSymbol(weight_model.symbol) && *end == '\0' && errno != ERANGE;
+    }
+    if (!valid) {
+      GOOGLE_LOG(ERROR) << "Invalid resource weight " << weight << " of "
+                        << method->full_name()
+                        << ", expected SYMBOL=weight with a symbol of upper case letters and"
+                        << " digits and a non-negative 64-bit weight.";
+      continue;
+    }
+    model->resource_weights.push_back(weight_model);
+  }
+  method_model->resource_weight_count =
+      model->resource_weights.size() - method_model->first_resource_weight;
+}
+
+void AddService(FileModel* model, const ServiceDescriptor* service) {
+  ServiceModel service_model = ServiceModel();
+  service_model.descriptor = service;
+  service_model.index = model->services.size();
+  service_model.state_type = service->options().GetExtension(aelf::csharp_state);
+  service_model.first_method = model->methods.size();
+  service_model.method_count = service->method_count();
+  // Bases are resolved when the service is first reached from the file.
+  service_model.first_base = -1;
+  for (int i = 0; i < service->method_count(); i++) {
+    MethodModel method_model = MethodModel();
+    method_model.descriptor = service->method(i);
+    method_model.service = service_model.index;
+    method_model.is_view = service->method(i)->options().GetExtension(aelf::is_view);
+    method_model.pool_input = service->method(i)->options().GetExtension(aelf::pool_input);
+    bool has_base_fee = service->method(i)->options().HasExtension(aelf::base_fee);
+    method_model.base_fee = service->method(i)->options().GetExtension(aelf::base_fee);
+    if (method_model.base_fee < 0) {
+      GOOGLE_LOG(ERROR) << "Invalid base fee " << method_model.base_fee << " of "
+                        << service->method(i)->full_name() << ", expected a non-negative fee.";
+      has_base_fee = false;
+      method_model.base_fee = 0;
+    }
+    AddResourceWeights(model, &method_model);
+    method_model.has_fee = has_base_fee || method_model.resource_weight_count > 0;
+    model->methods.push_back(method_model);
+  }
+  model->services.push_back(service_model);
+}
+
+void DepthFirstSearch(const FileDescriptor* file, FileModel* model,
+                      std::set<const FileDescriptor*>* seen) {
+  if (!seen->insert(file).second) {
+    return;
+  }
+
+  // Add all dependencies.
+  for (int i = 0; i < file->dependency_count(); i++) {
+    DepthFirstSearch(file->dependency(i), model, seen);
+  }
+
+  // Add all services of this file.
+  if (file == model->file) {
+    model->first_file_service = model->services.size();
+    model->file_service_count = file->service_count();
+  }
+  for (int i = 0; i < file->service_count(); i++) {
+    AddService(model, file->service(i));
+  }
+}
+
+// A base is either the name of a file, which stands for all services declared
+// in it, or the full name of a single service.
+void ResolveBases(FileModel* model, int service, const ServiceIndex& all_services) {
+  ServiceModel* service_model = &model->services[service];
+  const ServiceDescriptor* descriptor = service_model->descriptor;
+  service_model->first_base = model->service_bases.size();
+  int baseCount = descriptor->options().ExtensionSize(aelf::base);
+  for (int i = 0; i < baseCount; i++) {
+    std::string baseName = descriptor->options().GetExtension(aelf::base, i);
+    ServiceIndex::const_iterator found = all_services.find(baseName);
+    if(found == all_services.end()){
+      GOOGLE_LOG(ERROR) << "Can't find specified base " << baseName << ", did you forget to import it?";
+      continue;
+    }
+    model->service_bases.insert(model->service_bases.end(),
+                                found->second.begin(), found->second.end());
+  }
+  service_model->base_count = model->service_bases.size() - service_model->first_base;
+}
+
+void DepthFirstSearchForBase(FileModel* model, int service,
+                             const ServiceIndex& all_services,
+                             std::vector<bool>* seen) {
+  if ((*seen)[service]) {
+    return;
+  }
+  (*seen)[service] = true;
+
+  if (model->services[service].first_base < 0) {
+    ResolveBases(model, service, all_services);
+  }
+  // Add all dependencies.
+  for (int i = 0; i < model->services[service].base_count; i++) {
+    int base = model->service_bases[model->services[service].first_base + i];
+    DepthFirstSearchForBase(model, base, all_services, seen);
+  }
+
+  // Add this service.
+  model->full_services.push_back(service);
+}
+
+int GetServiceBaseDepth(const FileModel& model, int service,
+                        std::vector<int>* depths) {
+  if ((*depths)[service] >= 0) {
+    return (*depths)[service];
+  }
+  // Guards against cyclic bases while the depth is being computed.
+  (*depths)[service] = 0;
+
+  const ServiceModel& service_model = model.services[service];
+  int depth = 0;
+  for (int i = 0; i < service_model.base_count; i++) {
+    int base = model.service_bases[service_model.first_base + i];
+    depth = std::max(depth, GetServiceBaseDepth(model, base, depths) + 1);
+  }
+  (*depths)[service] = depth;
+  return depth;
+}
+
+void AddEvents(FileModel* model) {
+  const FileDescriptor* file = model->file;
+  for (int i = 0; i < file->message_type_count(); i++) {
+    const Descriptor* message = file->message_type(i);
+    if (!message->options().GetExtension(aelf::is_event)) {
+      continue;
+    }
+    EventModel event_model = EventModel();
+    event_model.descriptor = message;
+    event_model.first_field = model->fields.size();
+    event_model.field_count = message->field_count();
+    for (int j = 0; j < message->field_count(); j++) {
+      FieldModel field_model = FieldModel();
+      field_model.descriptor = message->field(j);
+      field_model.is_indexed = message->field(j)->options().GetExtension(aelf::is_indexed);
+      if (field_model.is_indexed) {
+        event_model.indexed_field_count++;
+      }
+      model->fields.push_back(field_model);
+    }
+    model->events.push_back(event_model);
+  }
+}
+
+}  // anonymous namespace
+
+FileModel BuildFileModel(const FileDescriptor* file) {
+  FileModel model;
+  model.file = file;
+  model.first_file_service = 0;
+  model.file_service_count = 0;
+
+  std::set<const FileDescriptor*> seen;
+  DepthFirstSearch(file, &model, &seen);
+
+  ServiceIndex all_services;
+  for (size_t i = 0; i < model.services.size(); i++) {
+    const ServiceDescriptor* service = model.services[i].descriptor;
+    all_services[service->file()->name()].push_back(i);
+    all_services[service->full_name()].push_back(i);
+  }
+
+  std::vector<int> depths(model.services.size(), -1);
+  // Only the services reached from one file service are reset before the
+  // next, so the search costs the size of its result rather than the number
+  // of services.
+  std::vector<bool> seenBases(model.services.size(), false);
+  for (int i = 0; i < model.file_service_count; i++) {
+    int service = model.first_file_service + i;
+    size_t first_full_service = model.full_services.size();
+    DepthFirstSearchForBase(&model, service, all_services, &seenBases);
+    for (size_t j = first_full_service; j < model.full_services.size(); j++) {
+      seenBases[model.full_services[j]] = false;
+    }
+
+    ServiceModel* service_model = &model.services[service];
+    service_model->first_full_service = first_full_service;
+    service_model->full_service_count = model.full_services.size() - first_full_service;
+    service_model->first_full_method = model.full_methods.size();
+    for (int j = 0; j < service_model->full_service_count; j++) {
+      const ServiceModel& full_service =
+          model.services[model.full_services[first_full_service + j]];
+      for (int k = 0; k < full_service.method_count; k++) {
+        model.full_methods.push_back(full_service.first_method + k);
+      }
+    }
+    service_model->full_method_count =
+        model.full_methods.size() - service_model->first_full_method;
+    service_model->base_depth = GetServiceBaseDepth(model, service, &depths);
+  }
+
+  AddEvents(&model);
+  return model;
+}
+
+}  // namespace grpc_contract_csharp_generator
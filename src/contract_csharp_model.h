@@ -0,0 +1,128 @@
+/*
+ *
+ * Copyright 2015 gRPC authors. Modified by AElfProject.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_INTERNAL_COMPILER_CONTRACT_CSHARP_MODEL_H
+#define GRPC_INTERNAL_COMPILER_CONTRACT_CSHARP_MODEL_H
+
+#include <vector>
+
+#include "config.h"
+
+namespace grpc_contract_csharp_generator {
+
+// Intermediate model of a proto file, built in one pass over its descriptors.
+// All AElf options are resolved here, so emitters never read options or walk
+// the descriptor graph themselves. Records refer to each other by index into
+// the flat arrays of FileModel.
+
+struct ServiceModel {
+  const grpc::protobuf::ServiceDescriptor* descriptor;
+  int index;  // Index in FileModel::services.
+  grpc::string state_type;  // aelf.csharp_state
+  // Own methods, in FileModel::methods.
+  int first_method;
+  int method_count;
+  // Resolved aelf.base services, in FileModel::service_bases.
+  int first_base;
+  int base_count;
+  // The flattened service, bases first, in FileModel::full_services and
+  // FileModel::full_methods. Only resolved for services of the file itself.
+  int first_full_service;
+  int full_service_count;
+  int first_full_method;
+  int full_method_count;
+  // Length of the longest aelf.base chain.
+  int base_depth;
+};
+
+struct MethodModel {
+  const grpc::protobuf::MethodDescriptor* descriptor;
+  int service;  // Index of the declaring service in FileModel::services.
+  bool is_view;  // aelf.is_view
+  bool pool_input;  // aelf.pool_input
+  // Whether aelf.base_fee or aelf.resource_weight is set.
+  bool has_fee;
+  grpc::protobuf::int64 base_fee;  // aelf.base_fee
+  // Parsed aelf.resource_weight, in FileModel::resource_weights.
+  int first_resource_weight;
+  int resource_weight_count;
+};
+
+struct ResourceWeightModel {
+  grpc::string symbol;
+  grpc::protobuf::int64 weight;
+};
+
+struct FieldModel {
+  const grpc::protobuf::FieldDescriptor* descriptor;
+  bool is_indexed;  // aelf.is_indexed
+};
+
+// A top level message of the file marked with aelf.is_event.
+struct EventModel {
+  const grpc::protobuf::Descriptor* descriptor;
+  // Fields, in FileModel::fields.
+  int first_field;
+  int field_count;
+  int indexed_field_count;
+};
+
+struct FileModel {
+  const grpc::protobuf::FileDescriptor* file;
+  // Services of the file and of all its dependencies, dependencies first.
+  std::vector<ServiceModel> services;
+  int first_file_service;
+  int file_service_count;
+  std::vector<MethodModel> methods;
+  std::vector<ResourceWeightModel> resource_weights;
+  std::vector<int> service_bases;
+  std::vector<int> full_services;
+  std::vector<int> full_methods;
+  std::vector<EventModel> events;
+  std::vector<FieldModel> fields;
+};
+
+FileModel BuildFileModel(const grpc::protobuf::FileDescriptor* file);
+
+inline const ServiceModel& GetFileService(const FileModel& model, int i) {
+  return model.services[model.first_file_service + i];
+}
+
+inline const ServiceModel& GetFullService(const FileModel& model,
+                                          const ServiceModel& service, int i) {
+  return model.services[model.full_services[service.first_full_service + i]];
+}
+
+inline const MethodModel& GetFullMethod(const FileModel& model,
+                                        const ServiceModel& service, int i) {
+  return model.methods[model.full_methods[service.first_full_method + i]];
+}
+
+inline const ResourceWeightModel& GetResourceWeight(const FileModel& model,
+                                                   const MethodModel& method, int i) {
+  return model.resource_weights[method.first_resource_weight + i];
+}
+
+inline const FieldModel& GetEventField(const FileModel& model,
+                                       const EventModel& event, int i) {
+  return model.fields[event.first_field + i];
+}
+
+}  // namespace grpc_contract_csharp_generator
+
+#endif  // GRPC_INTERNAL_COMPILER_CONTRACT_CSHARP_MODEL_H
@@ -18,7 +18,10 @@
 
 // Generates C# gRPC service interface out of Protobuf IDL.
 
+#include <cstdlib>
 #include <memory>
+#include <string>
+#include <thread>
 
 #include "config.h"
 #include "contract_csharp_generator.h"
@@ -29,6 +32,14 @@ public:
     ContractCSharpGrpcGenerator() {}
     ~ContractCSharpGrpcGenerator() {}
 
+#if GOOGLE_PROTOBUF_VERSION >= 3012000
+    // Proto3 optional fields are generated as the synthetic oneof members
+    // they are declared as.
+    uint64_t GetSupportedFeatures() const override {
+      return FEATURE_PROTO3_OPTIONAL;
+    }
+#endif
+
     bool Generate(const grpc::protobuf::FileDescriptor* file,
                   const grpc::string& parameter,
                   grpc::protobuf::compiler::GeneratorContext* context,
@@ -37,7 +48,10 @@ public:
       grpc::protobuf::compiler::ParseGeneratorParameter(parameter, &options);
 
       // default generate contract with event
-      char flags = grpc_contract_csharp_generator::GENERATE_CONTRACT_WITH_EVENT;
+      unsigned int flags = grpc_contract_csharp_generator::GENERATE_CONTRACT_WITH_EVENT;
+      bool write_stats = false;
+      bool write_abi = false;
+      int threads = 1;
 
       for (size_t i = 0; i < options.size(); i++) {
         if (options[i].first == "stub") {
@@ -53,13 +67,65 @@ public:
           flags &= ~grpc_contract_csharp_generator::GENERATE_EVENT;
         } else if (options[i].first == "internal_access") {
           flags |= grpc_contract_csharp_generator::INTERNAL_ACCESS;
+        } else if (options[i].first == "embedded_descriptor") {
+          flags |= grpc_contract_csharp_generator::EMBEDDED_DESCRIPTOR;
+        } else if (options[i].first == "batch") {
+          flags |= grpc_contract_csharp_generator::GENERATE_STUB_BATCH;
+        } else if (options[i].first == "event_bloom") {
+          flags |= grpc_contract_csharp_generator::GENERATE_EVENT_BLOOM;
+        } else if (options[i].first == "event_decoder") {
+          flags |= grpc_contract_csharp_generator::GENERATE_EVENT_DECODER;
+        } else if (options[i].first == "value_task") {
+          flags |= grpc_contract_csharp_generator::GENERATE_STUB_VALUE_TASK;
+        } else if (options[i].first == "reuse_base") {
+          flags |= grpc_contract_csharp_generator::REUSE_BASE_CONTAINER;
+        } else if (options[i].first == "lazy_init") {
+          flags |= grpc_contract_csharp_generator::LAZY_STATIC_INIT;
+        } else if (options[i].first == "bench") {
+          flags |= grpc_contract_csharp_generator::GENERATE_BENCHMARK;
+        } else if (options[i].first == "instrument") {
+          flags |= grpc_contract_csharp_generator::INSTRUMENT_CONTRACT;
+        } else if (options[i].first == "direct_stub") {
+          flags |= grpc_contract_csharp_generator::GENERATE_DIRECT_STUB;
+        } else if (options[i].first == "tx_template") {
+          flags |= grpc_contract_csharp_generator::GENERATE_STUB_TX_TEMPLATE;
+        } else if (options[i].first == "memo_view") {
+          flags |= grpc_contract_csharp_generator::GENERATE_REFERENCE_VIEW_MEMO;
+        } else if (options[i].first == "pool_input") {
+          flags |= grpc_contract_csharp_generator::POOL_CONTRACT_INPUT;
+        } else if (options[i].first == "event_batch") {
+          flags |= grpc_contract_csharp_generator::GENERATE_EVENT_BATCH;
+        } else if (options[i].first == "chunked_input") {
+          flags |= grpc_contract_csharp_generator::CHUNKED_STREAM_INPUT;
+        } else if (options[i].first == "event_router") {
+          flags |= grpc_contract_csharp_generator::GENERATE_EVENT_ROUTER;
+        } else if (options[i].first == "local_reference") {
+          flags |= grpc_contract_csharp_generator::GENERATE_REFERENCE_LOCAL;
+        } else if (options[i].first == "replay") {
+          flags |= grpc_contract_csharp_generator::GENERATE_REPLAY;
+        } else if (options[i].first == "stats") {
+          write_stats = true;
+        } else if (options[i].first == "abi") {
+          write_abi = true;
+        } else if (options[i].first == "threads") {
+          // threads=0 uses one thread per core.
+          const long kMaxThreads = 1024;
+          char* end = NULL;
+          long value = strtol(options[i].second.c_str(), &end, 10);
+          if (options[i].second.empty() || *end != '\0' || value < 0 || value > kMaxThreads) {
+            *error = "Invalid value of generator option threads: " + options[i].second +
+                     ", expected 0 to " + std::to_string(kMaxThreads);
+            return false;
+          }
+          threads = value == 0 ? std::thread::hardware_concurrency() : value;
         } else {
           *error = "Unknown generator option: " + options[i].first;
           return false;
         }
       }
 
-      grpc::string code = grpc_contract_csharp_generator::GetServices(file, flags);
+      grpc_contract_csharp_generator::GeneratorStats stats;
+      grpc::string code = grpc_contract_csharp_generator::GetServices(file, flags, &stats, threads);
       if (code.size() == 0) {
         return true;  // don't generate a file if there are no services
       }
@@ -73,6 +139,30 @@ public:
               context->Open(file_name));
       grpc::protobuf::io::CodedOutputStream coded_out(output.get());
       coded_out.WriteRaw(code.data(), code.size());
+
+      if (write_stats) {
+        grpc::string stats_file_name;
+        if (!grpc_contract_csharp_generator::StatsFilename(file, &stats_file_name)) {
+          return false;
+        }
+        grpc::string report = grpc_contract_csharp_generator::GetStatsReport(file, stats);
+        std::unique_ptr<grpc::protobuf::io::ZeroCopyOutputStream> stats_output(
+                context->Open(stats_file_name));
+        grpc::protobuf::io::CodedOutputStream stats_coded_out(stats_output.get());
+        stats_coded_out.WriteRaw(report.data(), report.size());
+      }
+
+      if (write_abi) {
+        grpc::string abi_file_name;
+        if (!grpc_contract_csharp_generator::AbiFilename(file, &abi_file_name)) {
+          return false;
+        }
+        grpc::string manifest = grpc_contract_csharp_generator::GetAbiManifest(file);
+        std::unique_ptr<grpc::protobuf::io::ZeroCopyOutputStream> abi_output(
+                context->Open(abi_file_name));
+        grpc::protobuf::io::CodedOutputStream abi_coded_out(abi_output.get());
+        abi_coded_out.WriteRaw(manifest.data(), manifest.size());
+      }
       return true;
     }
 };
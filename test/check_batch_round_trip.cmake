@@ -0,0 +1,69 @@
+# Generates the stub and the contract of one proto with the batch option and
+# checks that every call the stub batch can queue is dispatched by the
+# ExecuteBatch method of the contract container, and nothing else is, and
+# that ExecuteBatch is bound as a method of the contract.
+#
+# Required variables: PROTOC, PLUGIN, PROTO, PROTO_DIR, OPTIONS_DIR,
+# WELLKNOWN_DIR and OUTPUT_DIR, as for run_plugin_test.cmake.
+
+foreach(var PROTOC PLUGIN PROTO PROTO_DIR OPTIONS_DIR WELLKNOWN_DIR OUTPUT_DIR)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "${var} is not set")
+  endif()
+endforeach()
+
+file(REMOVE_RECURSE "${OUTPUT_DIR}")
+
+foreach(side contract stub)
+  if(side STREQUAL "stub")
+    set(parameter "stub,batch")
+  else()
+    set(parameter "batch")
+  endif()
+  file(MAKE_DIRECTORY "${OUTPUT_DIR}/${side}")
+  execute_process(COMMAND "${PROTOC}"
+                  "--plugin=protoc-gen-contract_csharp=${PLUGIN}"
+                  "--contract_csharp_out=${parameter}:${OUTPUT_DIR}/${side}"
+                  "-I${PROTO_DIR}" "-I${OPTIONS_DIR}" "-I${WELLKNOWN_DIR}"
+                  "${PROTO}"
+                  RESULT_VARIABLE result)
+  if(NOT result EQUAL 0)
+    message(FATAL_ERROR "protoc failed on ${PROTO} with parameter \"${parameter}\": ${result}")
+  endif()
+  file(GLOB ${side}_output "${OUTPUT_DIR}/${side}/*.c.cs")
+  file(READ "${${side}_output}" ${side}_code)
+endforeach()
+
+# Methods queued by the stub batch.
+string(FIND "${stub_code}" "StubBatch\n" start)
+if(start EQUAL -1)
+  message(FATAL_ERROR "No stub batch generated for ${PROTO}")
+endif()
+string(SUBSTRING "${stub_code}" ${start} -1 stub_code)
+string(REGEX MATCHALL "public BatchCall<[^\n]*> [A-Za-z0-9_]+\\(" queued "${stub_code}")
+string(REGEX REPLACE "public BatchCall<[^;]*> ([A-Za-z0-9_]+)\\(" "\\1" queued "${queued}")
+
+# ExecuteBatch must be callable as a method of the contract.
+string(FIND "${contract_code}" ".AddMethod(__Method_ExecuteBatch," bound)
+if(bound EQUAL -1)
+  message(FATAL_ERROR "ExecuteBatch is not bound in BindService for ${PROTO}")
+endif()
+
+# Methods dispatched by ExecuteBatch.
+string(FIND "${contract_code}" "ExecuteBatch(" start)
+if(start EQUAL -1)
+  message(FATAL_ERROR "No ExecuteBatch generated for ${PROTO}")
+endif()
+string(SUBSTRING "${contract_code}" ${start} -1 contract_code)
+string(FIND "${contract_code}" "default:" end)
+string(SUBSTRING "${contract_code}" 0 ${end} contract_code)
+string(REGEX MATCHALL "case \"[A-Za-z0-9_]+\":" dispatched "${contract_code}")
+string(REGEX REPLACE "case \"([A-Za-z0-9_]+)\":" "\\1" dispatched "${dispatched}")
+
+if(NOT queued)
+  message(FATAL_ERROR "The stub batch of ${PROTO} queues no method")
+endif()
+if(NOT "${queued}" STREQUAL "${dispatched}")
+  message(FATAL_ERROR "The stub batch queues ${queued} but ExecuteBatch dispatches ${dispatched}")
+endif()
+message(STATUS "Batched methods: ${queued}")
@@ -0,0 +1,57 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: base_without_events.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Standards.Base {
+
+  #region Events
+  #endregion
+  /// <summary>
+  /// A base contract that declares no events.
+  /// </summary>
+  public static partial class BaseContractContainer
+  {
+    static readonly string __ServiceName = "base.BaseContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    internal static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Initialize = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Initialize",
+        __Marshaller_google_protobuf_Empty,
+        __Marshaller_google_protobuf_Empty);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Standards.Base.BaseWithoutEventsReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.Base.BaseWithoutEventsReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+  }
+}
+#endregion
+
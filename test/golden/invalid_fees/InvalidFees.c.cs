@@ -0,0 +1,98 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: invalid_fees.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.Fees {
+
+  #region Events
+  #endregion
+  /// <summary>
+  /// Invalid fee options are reported and left out of the fee table.
+  /// </summary>
+  public static partial class FeesContractContainer
+  {
+    static readonly string __ServiceName = "fees.FeesContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Valid = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Valid",
+        __Marshaller_google_protobuf_Empty,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_NegativeBaseFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "NegativeBaseFee",
+        __Marshaller_google_protobuf_Empty,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_InvalidWeights = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "InvalidWeights",
+        __Marshaller_google_protobuf_Empty,
+        __Marshaller_google_protobuf_Empty);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.Fees.InvalidFeesReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Contracts.Fees.InvalidFeesReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Valid", (9223372036854775807, new (string Symbol, long Weight)[] { ("ELF", 9223372036854775807), ("READ2", 0) }) },
+          { "InvalidWeights", (10, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of FeesContract</summary>
+    public abstract partial class FeesContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.Fees.FeesContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Valid(global::Google.Protobuf.WellKnownTypes.Empty input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty NegativeBaseFee(global::Google.Protobuf.WellKnownTypes.Empty input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty InvalidWeights(global::Google.Protobuf.WellKnownTypes.Empty input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(FeesContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_Valid, serviceImpl.Valid)
+          .AddMethod(__Method_NegativeBaseFee, serviceImpl.NegativeBaseFee)
+          .AddMethod(__Method_InvalidWeights, serviceImpl.InvalidWeights).Build();
+    }
+
+  }
+}
+#endregion
+
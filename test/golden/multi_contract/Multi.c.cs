@@ -0,0 +1,244 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: multi.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.Multi {
+
+  #region Events
+  #endregion
+  internal static class MultiMarshallers
+  {
+    internal static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    internal static readonly aelf::Marshaller<global::AElf.Contracts.Multi.CountOutput> __Marshaller_multi_CountOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.Multi.CountOutput.Parser.ParseFrom);
+  }
+
+  public static partial class AdminContractContainer
+  {
+    static readonly string __ServiceName = "multi.AdminContract";
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        MultiMarshallers.__Marshaller_acs1_MethodFees,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        MultiMarshallers.__Marshaller_google_protobuf_StringValue,
+        MultiMarshallers.__Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        MultiMarshallers.__Marshaller_token_TransferInput,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        MultiMarshallers.__Marshaller_token_TransferInput,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        MultiMarshallers.__Marshaller_token_GetBalanceInput,
+        MultiMarshallers.__Marshaller_token_GetBalanceOutput);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Pause = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Pause",
+        MultiMarshallers.__Marshaller_google_protobuf_Empty,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.Multi.MultiReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+          global::AElf.Contracts.Multi.MultiReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of AdminContract</summary>
+    public abstract partial class AdminContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.Multi.MultiState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Pause(global::Google.Protobuf.WellKnownTypes.Empty input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(AdminContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance)
+          .AddMethod(__Method_Pause, serviceImpl.Pause).Build();
+    }
+
+  }
+  public static partial class QueryContractContainer
+  {
+    static readonly string __ServiceName = "multi.QueryContract";
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        MultiMarshallers.__Marshaller_acs1_MethodFees,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        MultiMarshallers.__Marshaller_google_protobuf_StringValue,
+        MultiMarshallers.__Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        MultiMarshallers.__Marshaller_token_TransferInput,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        MultiMarshallers.__Marshaller_token_TransferInput,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        MultiMarshallers.__Marshaller_token_GetBalanceInput,
+        MultiMarshallers.__Marshaller_token_GetBalanceOutput);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Pause = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Pause",
+        MultiMarshallers.__Marshaller_google_protobuf_Empty,
+        MultiMarshallers.__Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::AElf.Contracts.Multi.CountOutput> __Method_Count = new aelf::Method<global::Google.Protobuf.WellKnownTypes.Empty, global::AElf.Contracts.Multi.CountOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "Count",
+        MultiMarshallers.__Marshaller_google_protobuf_Empty,
+        MultiMarshallers.__Marshaller_multi_CountOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.Multi.MultiReflection.Descriptor.Services[1]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+          global::AElf.Contracts.Multi.MultiReflection.Descriptor.Services[0],
+          global::AElf.Contracts.Multi.MultiReflection.Descriptor.Services[1],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of QueryContract</summary>
+    public abstract partial class QueryContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.Multi.MultiState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Pause(global::Google.Protobuf.WellKnownTypes.Empty input);
+      public abstract global::AElf.Contracts.Multi.CountOutput Count(global::Google.Protobuf.WellKnownTypes.Empty input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(QueryContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance)
+          .AddMethod(__Method_Pause, serviceImpl.Pause)
+          .AddMethod(__Method_Count, serviceImpl.Count).Build();
+    }
+
+  }
+}
+#endregion
+
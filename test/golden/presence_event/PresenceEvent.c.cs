@@ -0,0 +1,237 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: presence_event.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.Presence {
+
+  #region Events
+  public partial class Recorded : aelf::IEvent<Recorded>
+  {
+    public global::System.Collections.Generic.IEnumerable<Recorded> GetIndexed()
+    {
+      return new List<Recorded>
+      {
+      new Recorded
+      {
+        Name = Name
+      },
+      };
+    }
+
+    public Recorded GetNonIndexed()
+    {
+      return new Recorded
+      {
+        Amount = Amount,
+        Account = Account,
+        Slot = Slot,
+      };
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Recorded> events, int[] sizes, Recorded[] messages)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var part = i * 2;
+        foreach (var indexed in e.GetIndexed())
+        {
+          messages[part++] = indexed;
+        }
+        messages[part] = e.GetNonIndexed();
+        for (var j = i * 2; j <= part; j++)
+        {
+          sizes[j] = messages[j].CalculateSize();
+          total += sizes[j];
+        }
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Recorded> events, global::AElf.Types.Address address, int[] sizes, Recorded[] messages, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Recorded";
+        logEvent.Indexed.Clear();
+        messages[i * 2 + 0].WriteTo(output);
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 0]));
+        offset += sizes[i * 2 + 0];
+        logEvent.Indexed.Add(part0);
+        messages[i * 2 + 1].WriteTo(output);
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 1]));
+        offset += sizes[i * 2 + 1];
+        logEvent.NonIndexed = part1;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Recorded> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 2];
+      var messages = new Recorded[events.Count * 2];
+      var total = __ComputeSizes(events, sizes, messages);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, messages, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      Recorded[] __messages = new Recorded[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Recorded> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 2];
+          __messages = new Recorded[events.Count * 2];
+        }
+        var total = __ComputeSizes(events, __sizes, __messages);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, __messages, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public partial class Cleared : aelf::IEvent<Cleared>
+  {
+    public global::System.Collections.Generic.IEnumerable<Cleared> GetIndexed()
+    {
+      return new List<Cleared>
+      {
+      new Cleared
+      {
+        Name = Name
+      },
+      };
+    }
+
+    public Cleared GetNonIndexed()
+    {
+      return new Cleared
+      {
+        Amount = Amount,
+      };
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Cleared> events, int[] sizes)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        int size;
+        size = 0;
+        if (e.Name.Length != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeStringSize(e.Name);
+        }
+        sizes[i * 2 + 0] = size;
+        total += size;
+        size = 0;
+        if (e.Amount != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeInt64Size(e.Amount);
+        }
+        sizes[i * 2 + 1] = size;
+        total += size;
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Cleared> events, global::AElf.Types.Address address, int[] sizes, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Cleared";
+        logEvent.Indexed.Clear();
+        if (e.Name.Length != 0)
+        {
+          output.WriteTag(10);
+          output.WriteString(e.Name);
+        }
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 0]));
+        offset += sizes[i * 2 + 0];
+        logEvent.Indexed.Add(part0);
+        if (e.Amount != 0)
+        {
+          output.WriteTag(16);
+          output.WriteInt64(e.Amount);
+        }
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 1]));
+        offset += sizes[i * 2 + 1];
+        logEvent.NonIndexed = part1;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Cleared> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 2];
+      var total = __ComputeSizes(events, sizes);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Cleared> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 2];
+        }
+        var total = __ComputeSizes(events, __sizes);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  #endregion
+}
+#endregion
+
@@ -0,0 +1,293 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of TokenContract</summary>
+    public abstract partial class TokenContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.MultiToken.TokenContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(TokenContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance)
+          .AddMethod(__Method_ExecuteBatch, input => new global::Google.Protobuf.WellKnownTypes.BytesValue
+          {
+            Value = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(ExecuteBatch(serviceImpl, input.Value.ToByteArray()))
+          }).Build();
+    }
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.BytesValue, global::Google.Protobuf.WellKnownTypes.BytesValue> __Method_ExecuteBatch =
+        new aelf::Method<global::Google.Protobuf.WellKnownTypes.BytesValue, global::Google.Protobuf.WellKnownTypes.BytesValue>(
+            aelf::MethodType.Action,
+            __ServiceName,
+            "ExecuteBatch",
+            aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.BytesValue.Parser.ParseFrom),
+            aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.BytesValue.Parser.ParseFrom));
+
+    public static byte[] ExecuteBatch(TokenContractBase serviceImpl, byte[] batch)
+    {
+      var input = new global::Google.Protobuf.CodedInputStream(batch);
+      var count = input.ReadInt32();
+      // Each call takes at least two bytes.
+      if (count < 0 || count > batch.Length / 2)
+      {
+        throw new global::System.InvalidOperationException("Invalid count of calls in the batch: " + count + ".");
+      }
+      var calls = new global::System.Func<byte[]>[count];
+      for (var i = 0; i < count; i++)
+      {
+        if (input.IsAtEnd)
+        {
+          throw new global::System.InvalidOperationException("The batch holds " + i + " calls instead of " + count + ".");
+        }
+        var methodName = input.ReadString();
+        var request = input.ReadBytes().ToByteArray();
+        switch (methodName)
+        {
+          case "SetMethodFee":
+          {
+            var methodInput = __Method_SetMethodFee.RequestMarshaller.Deserializer(request);
+            calls[i] = () => __Method_SetMethodFee.ResponseMarshaller.Serializer(serviceImpl.SetMethodFee(methodInput));
+            break;
+          }
+          case "GetMethodFee":
+          {
+            var methodInput = __Method_GetMethodFee.RequestMarshaller.Deserializer(request);
+            calls[i] = () => __Method_GetMethodFee.ResponseMarshaller.Serializer(serviceImpl.GetMethodFee(methodInput));
+            break;
+          }
+          case "Transfer":
+          {
+            var methodInput = __Method_Transfer.RequestMarshaller.Deserializer(request);
+            calls[i] = () => __Method_Transfer.ResponseMarshaller.Serializer(serviceImpl.Transfer(methodInput));
+            break;
+          }
+          case "GetBalance":
+          {
+            var methodInput = __Method_GetBalance.RequestMarshaller.Deserializer(request);
+            calls[i] = () => __Method_GetBalance.ResponseMarshaller.Serializer(serviceImpl.GetBalance(methodInput));
+            break;
+          }
+          default:
+            throw new global::System.InvalidOperationException("Method " + methodName + " can't be executed in a batch.");
+        }
+      }
+      if (!input.IsAtEnd)
+      {
+        throw new global::System.InvalidOperationException("The batch holds more than " + count + " calls.");
+      }
+
+      var outputs = new byte[count][];
+      var size = 0;
+      for (var i = 0; i < count; i++)
+      {
+        outputs[i] = calls[i]();
+        size += global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(outputs[i].Length) + outputs[i].Length;
+      }
+      var buffer = new byte[size];
+      var stream = new global::Google.Protobuf.CodedOutputStream(buffer);
+      foreach (var bytes in outputs)
+      {
+        stream.WriteBytes(global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(bytes));
+      }
+      stream.CheckNoSpaceLeft();
+      return buffer;
+    }
+
+  }
+}
+#endregion
+
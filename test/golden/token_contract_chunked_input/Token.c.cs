@@ -0,0 +1,283 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    #region Chunked Input
+    public sealed class ChunkedInput<T> : global::System.Collections.Generic.IEnumerable<T>
+        where T : global::Google.Protobuf.IMessage<T>
+    {
+      readonly byte[] __data;
+      readonly global::Google.Protobuf.MessageParser<T> __parser;
+
+      public ChunkedInput(byte[] data, global::Google.Protobuf.MessageParser<T> parser)
+      {
+        __data = data;
+        __parser = parser;
+      }
+
+      public static ChunkedInput<T> FromChunks(global::System.Collections.Generic.IEnumerable<T> chunks, global::Google.Protobuf.MessageParser<T> parser)
+      {
+        var stream = new global::System.IO.MemoryStream();
+        foreach (var chunk in chunks)
+        {
+          global::Google.Protobuf.MessageExtensions.WriteDelimitedTo(chunk, stream);
+        }
+        return new ChunkedInput<T>(stream.ToArray(), parser);
+      }
+
+      public byte[] ToByteArray()
+      {
+        return __data;
+      }
+
+      public global::System.Collections.Generic.IEnumerator<T> GetEnumerator()
+      {
+        var offset = 0;
+        while (offset < __data.Length)
+        {
+          var length = 0;
+          for (var shift = 0; ; shift += 7)
+          {
+            if (offset == __data.Length || shift > 28)
+            {
+              throw new global::System.FormatException("Malformed chunked input.");
+            }
+            var b = __data[offset++];
+            length |= (b & 0x7F) << shift;
+            if (b < 0x80)
+            {
+              break;
+            }
+          }
+          if (length < 0 || length > __data.Length - offset)
+          {
+            throw new global::System.FormatException("Malformed chunked input.");
+          }
+          var chunk = __parser.ParseFrom(__data, offset, length);
+          offset += length;
+          yield return chunk;
+        }
+      }
+
+      global::System.Collections.IEnumerator global::System.Collections.IEnumerable.GetEnumerator()
+      {
+        return GetEnumerator();
+      }
+    }
+
+    static aelf::Method<ChunkedInput<TInput>, TOutput> __Chunked<TInput, TOutput>(aelf::Method<TInput, TOutput> method, global::Google.Protobuf.MessageParser<TInput> parser)
+        where TInput : global::Google.Protobuf.IMessage<TInput>
+    {
+      return new aelf::Method<ChunkedInput<TInput>, TOutput>(method.Type, method.ServiceName, method.Name,
+          aelf::Marshallers.Create((ChunkedInput<TInput> input) => input.ToByteArray(), bytes => new ChunkedInput<TInput>(bytes, parser)),
+          method.ResponseMarshaller);
+    }
+    #endregion
+
+    /// <summary>Base class for the contract of TokenContract</summary>
+    public abstract partial class TokenContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.MultiToken.TokenContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(ChunkedInput<global::AElf.Contracts.MultiToken.TransferInput> input);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(TokenContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Chunked(__Method_BatchTransfer, global::AElf.Contracts.MultiToken.TransferInput.Parser), serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance).Build();
+    }
+
+  }
+}
+#endregion
+
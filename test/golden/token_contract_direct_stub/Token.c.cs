@@ -0,0 +1,267 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of TokenContract</summary>
+    public abstract partial class TokenContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.MultiToken.TokenContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(TokenContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance).Build();
+    }
+
+    public class TokenContractDirectStub
+    {
+      readonly TokenContractBase __contract;
+      readonly bool __roundTrip;
+
+      public TokenContractDirectStub(TokenContractBase contract, bool roundTrip = false)
+      {
+        __contract = contract;
+        __roundTrip = roundTrip;
+      }
+
+      public global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        if (!__roundTrip)
+        {
+          return __contract.SetMethodFee(input);
+        }
+        var method = __Method_SetMethodFee;
+        var output = __contract.SetMethodFee(method.RequestMarshaller.Deserializer(method.RequestMarshaller.Serializer(input)));
+        return method.ResponseMarshaller.Deserializer(method.ResponseMarshaller.Serializer(output));
+      }
+
+      public global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        if (!__roundTrip)
+        {
+          return __contract.GetMethodFee(input);
+        }
+        var method = __Method_GetMethodFee;
+        var output = __contract.GetMethodFee(method.RequestMarshaller.Deserializer(method.RequestMarshaller.Serializer(input)));
+        return method.ResponseMarshaller.Deserializer(method.ResponseMarshaller.Serializer(output));
+      }
+
+      public global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        if (!__roundTrip)
+        {
+          return __contract.Transfer(input);
+        }
+        var method = __Method_Transfer;
+        var output = __contract.Transfer(method.RequestMarshaller.Deserializer(method.RequestMarshaller.Serializer(input)));
+        return method.ResponseMarshaller.Deserializer(method.ResponseMarshaller.Serializer(output));
+      }
+
+      public global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        if (!__roundTrip)
+        {
+          return __contract.GetBalance(input);
+        }
+        var method = __Method_GetBalance;
+        var output = __contract.GetBalance(method.RequestMarshaller.Deserializer(method.RequestMarshaller.Serializer(input)));
+        return method.ResponseMarshaller.Deserializer(method.ResponseMarshaller.Serializer(output));
+      }
+    }
+
+  }
+}
+#endregion
+
@@ -0,0 +1,919 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    static global::System.ReadOnlySpan<byte> __DescriptorData => new byte[]
+    {
+      0x0A, 0xF3, 0x3B, 0x0A, 0x20, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2F, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x2E,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x0F, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72,
+      0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x22, 0x4D, 0x0A, 0x11, 0x46, 0x69, 0x6C, 0x65, 0x44, 0x65,
+      0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x53, 0x65, 0x74, 0x12, 0x38, 0x0A, 0x04, 0x66,
+      0x69, 0x6C, 0x65, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67,
+      0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x6C, 0x65,
+      0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52,
+      0x04, 0x66, 0x69, 0x6C, 0x65, 0x22, 0xE4, 0x04, 0x0A, 0x13, 0x46, 0x69, 0x6C, 0x65, 0x44, 0x65,
+      0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x12, 0x0A,
+      0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6E, 0x61, 0x6D,
+      0x65, 0x12, 0x18, 0x0A, 0x07, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x18, 0x02, 0x20, 0x01,
+      0x28, 0x09, 0x52, 0x07, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x12, 0x1E, 0x0A, 0x0A, 0x64,
+      0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x18, 0x03, 0x20, 0x03, 0x28, 0x09, 0x52,
+      0x0A, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x12, 0x2B, 0x0A, 0x11, 0x70,
+      0x75, 0x62, 0x6C, 0x69, 0x63, 0x5F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79,
+      0x18, 0x0A, 0x20, 0x03, 0x28, 0x05, 0x52, 0x10, 0x70, 0x75, 0x62, 0x6C, 0x69, 0x63, 0x44, 0x65,
+      0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x12, 0x27, 0x0A, 0x0F, 0x77, 0x65, 0x61, 0x6B,
+      0x5F, 0x64, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63, 0x79, 0x18, 0x0B, 0x20, 0x03, 0x28,
+      0x05, 0x52, 0x0E, 0x77, 0x65, 0x61, 0x6B, 0x44, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x65, 0x6E, 0x63,
+      0x79, 0x12, 0x43, 0x0A, 0x0C, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x5F, 0x74, 0x79, 0x70,
+      0x65, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x20, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69,
+      0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x0B, 0x6D, 0x65, 0x73, 0x73, 0x61,
+      0x67, 0x65, 0x54, 0x79, 0x70, 0x65, 0x12, 0x41, 0x0A, 0x09, 0x65, 0x6E, 0x75, 0x6D, 0x5F, 0x74,
+      0x79, 0x70, 0x65, 0x18, 0x05, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67,
+      0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45, 0x6E, 0x75, 0x6D,
+      0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52,
+      0x08, 0x65, 0x6E, 0x75, 0x6D, 0x54, 0x79, 0x70, 0x65, 0x12, 0x41, 0x0A, 0x07, 0x73, 0x65, 0x72,
+      0x76, 0x69, 0x63, 0x65, 0x18, 0x06, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x27, 0x2E, 0x67, 0x6F, 0x6F,
+      0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x53, 0x65, 0x72,
+      0x76, 0x69, 0x63, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72,
+      0x6F, 0x74, 0x6F, 0x52, 0x07, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x12, 0x43, 0x0A, 0x09,
+      0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x18, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32,
+      0x25, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75,
+      0x66, 0x2E, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F,
+      0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x09, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
+      0x6E, 0x12, 0x36, 0x0A, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x08, 0x20, 0x01,
+      0x28, 0x0B, 0x32, 0x1C, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x6C, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+      0x52, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x49, 0x0A, 0x10, 0x73, 0x6F, 0x75,
+      0x72, 0x63, 0x65, 0x5F, 0x63, 0x6F, 0x64, 0x65, 0x5F, 0x69, 0x6E, 0x66, 0x6F, 0x18, 0x09, 0x20,
+      0x01, 0x28, 0x0B, 0x32, 0x1F, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x43, 0x6F, 0x64, 0x65,
+      0x49, 0x6E, 0x66, 0x6F, 0x52, 0x0E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x43, 0x6F, 0x64, 0x65,
+      0x49, 0x6E, 0x66, 0x6F, 0x12, 0x16, 0x0A, 0x06, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x18, 0x0C,
+      0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x73, 0x79, 0x6E, 0x74, 0x61, 0x78, 0x22, 0xB9, 0x06, 0x0A,
+      0x0F, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F,
+      0x12, 0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04,
+      0x6E, 0x61, 0x6D, 0x65, 0x12, 0x3B, 0x0A, 0x05, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x18, 0x02, 0x20,
+      0x03, 0x28, 0x0B, 0x32, 0x25, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72,
+      0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x05, 0x66, 0x69, 0x65, 0x6C,
+      0x64, 0x12, 0x43, 0x0A, 0x09, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x18, 0x06,
+      0x20, 0x03, 0x28, 0x0B, 0x32, 0x25, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72,
+      0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x44, 0x65, 0x73, 0x63,
+      0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x09, 0x65, 0x78, 0x74,
+      0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x12, 0x41, 0x0A, 0x0B, 0x6E, 0x65, 0x73, 0x74, 0x65, 0x64,
+      0x5F, 0x74, 0x79, 0x70, 0x65, 0x18, 0x03, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x20, 0x2E, 0x67, 0x6F,
+      0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x44, 0x65,
+      0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x0A, 0x6E,
+      0x65, 0x73, 0x74, 0x65, 0x64, 0x54, 0x79, 0x70, 0x65, 0x12, 0x41, 0x0A, 0x09, 0x65, 0x6E, 0x75,
+      0x6D, 0x5F, 0x74, 0x79, 0x70, 0x65, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45,
+      0x6E, 0x75, 0x6D, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F,
+      0x74, 0x6F, 0x52, 0x08, 0x65, 0x6E, 0x75, 0x6D, 0x54, 0x79, 0x70, 0x65, 0x12, 0x58, 0x0A, 0x0F,
+      0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x18,
+      0x05, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x2F, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+      0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x2E, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
+      0x6E, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x52, 0x0E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F,
+      0x6E, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x12, 0x44, 0x0A, 0x0A, 0x6F, 0x6E, 0x65, 0x6F, 0x66, 0x5F,
+      0x64, 0x65, 0x63, 0x6C, 0x18, 0x08, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x25, 0x2E, 0x67, 0x6F, 0x6F,
+      0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4F, 0x6E, 0x65,
+      0x6F, 0x66, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74,
+      0x6F, 0x52, 0x09, 0x6F, 0x6E, 0x65, 0x6F, 0x66, 0x44, 0x65, 0x63, 0x6C, 0x12, 0x39, 0x0A, 0x07,
+      0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x1F, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x4D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07,
+      0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x55, 0x0A, 0x0E, 0x72, 0x65, 0x73, 0x65, 0x72,
+      0x76, 0x65, 0x64, 0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x18, 0x09, 0x20, 0x03, 0x28, 0x0B, 0x32,
+      0x2E, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75,
+      0x66, 0x2E, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74,
+      0x6F, 0x2E, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x52,
+      0x0D, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x12, 0x23,
+      0x0A, 0x0D, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x18,
+      0x0A, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0C, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x4E,
+      0x61, 0x6D, 0x65, 0x1A, 0x7A, 0x0A, 0x0E, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E,
+      0x52, 0x61, 0x6E, 0x67, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x18, 0x01,
+      0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x12, 0x10, 0x0A, 0x03, 0x65,
+      0x6E, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x03, 0x65, 0x6E, 0x64, 0x12, 0x40, 0x0A,
+      0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x26,
+      0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66,
+      0x2E, 0x45, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x4F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x1A,
+      0x37, 0x0A, 0x0D, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52, 0x61, 0x6E, 0x67, 0x65,
+      0x12, 0x14, 0x0A, 0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52,
+      0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x12, 0x10, 0x0A, 0x03, 0x65, 0x6E, 0x64, 0x18, 0x02, 0x20,
+      0x01, 0x28, 0x05, 0x52, 0x03, 0x65, 0x6E, 0x64, 0x22, 0x7C, 0x0A, 0x15, 0x45, 0x78, 0x74, 0x65,
+      0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x73, 0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74,
+      0x65, 0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B,
+      0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62,
+      0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64,
+      0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70,
+      0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x09, 0x08, 0xE8, 0x07,
+      0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x22, 0xC1, 0x06, 0x0A, 0x14, 0x46, 0x69, 0x65, 0x6C, 0x64,
+      0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x12,
+      0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6E,
+      0x61, 0x6D, 0x65, 0x12, 0x16, 0x0A, 0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x18, 0x03, 0x20,
+      0x01, 0x28, 0x05, 0x52, 0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x12, 0x41, 0x0A, 0x05, 0x6C,
+      0x61, 0x62, 0x65, 0x6C, 0x18, 0x04, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x2B, 0x2E, 0x67, 0x6F, 0x6F,
+      0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x65,
+      0x6C, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74,
+      0x6F, 0x2E, 0x4C, 0x61, 0x62, 0x65, 0x6C, 0x52, 0x05, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x12, 0x3E,
+      0x0A, 0x04, 0x74, 0x79, 0x70, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x2A, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46,
+      0x69, 0x65, 0x6C, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72,
+      0x6F, 0x74, 0x6F, 0x2E, 0x54, 0x79, 0x70, 0x65, 0x52, 0x04, 0x74, 0x79, 0x70, 0x65, 0x12, 0x1B,
+      0x0A, 0x09, 0x74, 0x79, 0x70, 0x65, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x06, 0x20, 0x01, 0x28,
+      0x09, 0x52, 0x08, 0x74, 0x79, 0x70, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x12, 0x1A, 0x0A, 0x08, 0x65,
+      0x78, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x08, 0x65,
+      0x78, 0x74, 0x65, 0x6E, 0x64, 0x65, 0x65, 0x12, 0x23, 0x0A, 0x0D, 0x64, 0x65, 0x66, 0x61, 0x75,
+      0x6C, 0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x07, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0C,
+      0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x1F, 0x0A, 0x0B,
+      0x6F, 0x6E, 0x65, 0x6F, 0x66, 0x5F, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x18, 0x09, 0x20, 0x01, 0x28,
+      0x05, 0x52, 0x0A, 0x6F, 0x6E, 0x65, 0x6F, 0x66, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x12, 0x1B, 0x0A,
+      0x09, 0x6A, 0x73, 0x6F, 0x6E, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x0A, 0x20, 0x01, 0x28, 0x09,
+      0x52, 0x08, 0x6A, 0x73, 0x6F, 0x6E, 0x4E, 0x61, 0x6D, 0x65, 0x12, 0x37, 0x0A, 0x07, 0x6F, 0x70,
+      0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x08, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x1D, 0x2E, 0x67, 0x6F,
+      0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69,
+      0x65, 0x6C, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x73, 0x12, 0x27, 0x0A, 0x0F, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x33, 0x5F, 0x6F, 0x70,
+      0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x18, 0x11, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0E, 0x70, 0x72,
+      0x6F, 0x74, 0x6F, 0x33, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x22, 0xB6, 0x02, 0x0A,
+      0x04, 0x54, 0x79, 0x70, 0x65, 0x12, 0x0F, 0x0A, 0x0B, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x44, 0x4F,
+      0x55, 0x42, 0x4C, 0x45, 0x10, 0x01, 0x12, 0x0E, 0x0A, 0x0A, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x46,
+      0x4C, 0x4F, 0x41, 0x54, 0x10, 0x02, 0x12, 0x0E, 0x0A, 0x0A, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x49,
+      0x4E, 0x54, 0x36, 0x34, 0x10, 0x03, 0x12, 0x0F, 0x0A, 0x0B, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x55,
+      0x49, 0x4E, 0x54, 0x36, 0x34, 0x10, 0x04, 0x12, 0x0E, 0x0A, 0x0A, 0x54, 0x59, 0x50, 0x45, 0x5F,
+      0x49, 0x4E, 0x54, 0x33, 0x32, 0x10, 0x05, 0x12, 0x10, 0x0A, 0x0C, 0x54, 0x59, 0x50, 0x45, 0x5F,
+      0x46, 0x49, 0x58, 0x45, 0x44, 0x36, 0x34, 0x10, 0x06, 0x12, 0x10, 0x0A, 0x0C, 0x54, 0x59, 0x50,
+      0x45, 0x5F, 0x46, 0x49, 0x58, 0x45, 0x44, 0x33, 0x32, 0x10, 0x07, 0x12, 0x0D, 0x0A, 0x09, 0x54,
+      0x59, 0x50, 0x45, 0x5F, 0x42, 0x4F, 0x4F, 0x4C, 0x10, 0x08, 0x12, 0x0F, 0x0A, 0x0B, 0x54, 0x59,
+      0x50, 0x45, 0x5F, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x10, 0x09, 0x12, 0x0E, 0x0A, 0x0A, 0x54,
+      0x59, 0x50, 0x45, 0x5F, 0x47, 0x52, 0x4F, 0x55, 0x50, 0x10, 0x0A, 0x12, 0x10, 0x0A, 0x0C, 0x54,
+      0x59, 0x50, 0x45, 0x5F, 0x4D, 0x45, 0x53, 0x53, 0x41, 0x47, 0x45, 0x10, 0x0B, 0x12, 0x0E, 0x0A,
+      0x0A, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x42, 0x59, 0x54, 0x45, 0x53, 0x10, 0x0C, 0x12, 0x0F, 0x0A,
+      0x0B, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x55, 0x49, 0x4E, 0x54, 0x33, 0x32, 0x10, 0x0D, 0x12, 0x0D,
+      0x0A, 0x09, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x45, 0x4E, 0x55, 0x4D, 0x10, 0x0E, 0x12, 0x11, 0x0A,
+      0x0D, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x53, 0x46, 0x49, 0x58, 0x45, 0x44, 0x33, 0x32, 0x10, 0x0F,
+      0x12, 0x11, 0x0A, 0x0D, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x53, 0x46, 0x49, 0x58, 0x45, 0x44, 0x36,
+      0x34, 0x10, 0x10, 0x12, 0x0F, 0x0A, 0x0B, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x53, 0x49, 0x4E, 0x54,
+      0x33, 0x32, 0x10, 0x11, 0x12, 0x0F, 0x0A, 0x0B, 0x54, 0x59, 0x50, 0x45, 0x5F, 0x53, 0x49, 0x4E,
+      0x54, 0x36, 0x34, 0x10, 0x12, 0x22, 0x43, 0x0A, 0x05, 0x4C, 0x61, 0x62, 0x65, 0x6C, 0x12, 0x12,
+      0x0A, 0x0E, 0x4C, 0x41, 0x42, 0x45, 0x4C, 0x5F, 0x4F, 0x50, 0x54, 0x49, 0x4F, 0x4E, 0x41, 0x4C,
+      0x10, 0x01, 0x12, 0x12, 0x0A, 0x0E, 0x4C, 0x41, 0x42, 0x45, 0x4C, 0x5F, 0x52, 0x45, 0x51, 0x55,
+      0x49, 0x52, 0x45, 0x44, 0x10, 0x02, 0x12, 0x12, 0x0A, 0x0E, 0x4C, 0x41, 0x42, 0x45, 0x4C, 0x5F,
+      0x52, 0x45, 0x50, 0x45, 0x41, 0x54, 0x45, 0x44, 0x10, 0x03, 0x22, 0x63, 0x0A, 0x14, 0x4F, 0x6E,
+      0x65, 0x6F, 0x66, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F,
+      0x74, 0x6F, 0x12, 0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+      0x52, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x37, 0x0A, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x1D, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4F, 0x6E, 0x65, 0x6F, 0x66, 0x4F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22,
+      0xE3, 0x02, 0x0A, 0x13, 0x45, 0x6E, 0x75, 0x6D, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
+      0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18,
+      0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x3F, 0x0A, 0x05, 0x76,
+      0x61, 0x6C, 0x75, 0x65, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x29, 0x2E, 0x67, 0x6F, 0x6F,
+      0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45, 0x6E, 0x75,
+      0x6D, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72,
+      0x50, 0x72, 0x6F, 0x74, 0x6F, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x36, 0x0A, 0x07,
+      0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x1C, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x45, 0x6E, 0x75, 0x6D, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74,
+      0x69, 0x6F, 0x6E, 0x73, 0x12, 0x5D, 0x0A, 0x0E, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64,
+      0x5F, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x18, 0x04, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x36, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45,
+      0x6E, 0x75, 0x6D, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F,
+      0x74, 0x6F, 0x2E, 0x45, 0x6E, 0x75, 0x6D, 0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52,
+      0x61, 0x6E, 0x67, 0x65, 0x52, 0x0D, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52, 0x61,
+      0x6E, 0x67, 0x65, 0x12, 0x23, 0x0A, 0x0D, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x5F,
+      0x6E, 0x61, 0x6D, 0x65, 0x18, 0x05, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0C, 0x72, 0x65, 0x73, 0x65,
+      0x72, 0x76, 0x65, 0x64, 0x4E, 0x61, 0x6D, 0x65, 0x1A, 0x3B, 0x0A, 0x11, 0x45, 0x6E, 0x75, 0x6D,
+      0x52, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x12, 0x14, 0x0A,
+      0x05, 0x73, 0x74, 0x61, 0x72, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x73, 0x74,
+      0x61, 0x72, 0x74, 0x12, 0x10, 0x0A, 0x03, 0x65, 0x6E, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x05,
+      0x52, 0x03, 0x65, 0x6E, 0x64, 0x22, 0x83, 0x01, 0x0A, 0x18, 0x45, 0x6E, 0x75, 0x6D, 0x56, 0x61,
+      0x6C, 0x75, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F,
+      0x74, 0x6F, 0x12, 0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09,
+      0x52, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x16, 0x0A, 0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72,
+      0x18, 0x02, 0x20, 0x01, 0x28, 0x05, 0x52, 0x06, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x12, 0x3B,
+      0x0A, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0B, 0x32,
+      0x21, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75,
+      0x66, 0x2E, 0x45, 0x6E, 0x75, 0x6D, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F,
+      0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0xA7, 0x01, 0x0A, 0x16,
+      0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F,
+      0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01,
+      0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x3E, 0x0A, 0x06, 0x6D, 0x65,
+      0x74, 0x68, 0x6F, 0x64, 0x18, 0x02, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x26, 0x2E, 0x67, 0x6F, 0x6F,
+      0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D, 0x65, 0x74,
+      0x68, 0x6F, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F,
+      0x74, 0x6F, 0x52, 0x06, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x12, 0x39, 0x0A, 0x07, 0x6F, 0x70,
+      0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x1F, 0x2E, 0x67, 0x6F,
+      0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x53, 0x65,
+      0x72, 0x76, 0x69, 0x63, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70,
+      0x74, 0x69, 0x6F, 0x6E, 0x73, 0x22, 0x89, 0x02, 0x0A, 0x15, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64,
+      0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x12,
+      0x12, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6E,
+      0x61, 0x6D, 0x65, 0x12, 0x1D, 0x0A, 0x0A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x5F, 0x74, 0x79, 0x70,
+      0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x54, 0x79,
+      0x70, 0x65, 0x12, 0x1F, 0x0A, 0x0B, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x5F, 0x74, 0x79, 0x70,
+      0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0A, 0x6F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x54,
+      0x79, 0x70, 0x65, 0x12, 0x38, 0x0A, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x04,
+      0x20, 0x01, 0x28, 0x0B, 0x32, 0x1E, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72,
+      0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74,
+      0x69, 0x6F, 0x6E, 0x73, 0x52, 0x07, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x30, 0x0A,
+      0x10, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x69, 0x6E,
+      0x67, 0x18, 0x05, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0F,
+      0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x69, 0x6E, 0x67, 0x12,
+      0x30, 0x0A, 0x10, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x5F, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D,
+      0x69, 0x6E, 0x67, 0x18, 0x06, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65,
+      0x52, 0x0F, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x53, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x69, 0x6E,
+      0x67, 0x22, 0x91, 0x09, 0x0A, 0x0B, 0x46, 0x69, 0x6C, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x73, 0x12, 0x21, 0x0A, 0x0C, 0x6A, 0x61, 0x76, 0x61, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67,
+      0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0B, 0x6A, 0x61, 0x76, 0x61, 0x50, 0x61, 0x63,
+      0x6B, 0x61, 0x67, 0x65, 0x12, 0x30, 0x0A, 0x14, 0x6A, 0x61, 0x76, 0x61, 0x5F, 0x6F, 0x75, 0x74,
+      0x65, 0x72, 0x5F, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x08, 0x20, 0x01,
+      0x28, 0x09, 0x52, 0x12, 0x6A, 0x61, 0x76, 0x61, 0x4F, 0x75, 0x74, 0x65, 0x72, 0x43, 0x6C, 0x61,
+      0x73, 0x73, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x35, 0x0A, 0x13, 0x6A, 0x61, 0x76, 0x61, 0x5F, 0x6D,
+      0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x18, 0x0A, 0x20,
+      0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x11, 0x6A, 0x61, 0x76, 0x61,
+      0x4D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x73, 0x12, 0x44, 0x0A,
+      0x1D, 0x6A, 0x61, 0x76, 0x61, 0x5F, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x5F, 0x65,
+      0x71, 0x75, 0x61, 0x6C, 0x73, 0x5F, 0x61, 0x6E, 0x64, 0x5F, 0x68, 0x61, 0x73, 0x68, 0x18, 0x14,
+      0x20, 0x01, 0x28, 0x08, 0x42, 0x02, 0x18, 0x01, 0x52, 0x19, 0x6A, 0x61, 0x76, 0x61, 0x47, 0x65,
+      0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x45, 0x71, 0x75, 0x61, 0x6C, 0x73, 0x41, 0x6E, 0x64, 0x48,
+      0x61, 0x73, 0x68, 0x12, 0x3A, 0x0A, 0x16, 0x6A, 0x61, 0x76, 0x61, 0x5F, 0x73, 0x74, 0x72, 0x69,
+      0x6E, 0x67, 0x5F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x5F, 0x75, 0x74, 0x66, 0x38, 0x18, 0x1B, 0x20,
+      0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x13, 0x6A, 0x61, 0x76, 0x61,
+      0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x55, 0x74, 0x66, 0x38, 0x12,
+      0x53, 0x0A, 0x0C, 0x6F, 0x70, 0x74, 0x69, 0x6D, 0x69, 0x7A, 0x65, 0x5F, 0x66, 0x6F, 0x72, 0x18,
+      0x09, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x29, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x6C, 0x65, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x73, 0x2E, 0x4F, 0x70, 0x74, 0x69, 0x6D, 0x69, 0x7A, 0x65, 0x4D, 0x6F, 0x64, 0x65,
+      0x3A, 0x05, 0x53, 0x50, 0x45, 0x45, 0x44, 0x52, 0x0B, 0x6F, 0x70, 0x74, 0x69, 0x6D, 0x69, 0x7A,
+      0x65, 0x46, 0x6F, 0x72, 0x12, 0x1D, 0x0A, 0x0A, 0x67, 0x6F, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61,
+      0x67, 0x65, 0x18, 0x0B, 0x20, 0x01, 0x28, 0x09, 0x52, 0x09, 0x67, 0x6F, 0x50, 0x61, 0x63, 0x6B,
+      0x61, 0x67, 0x65, 0x12, 0x35, 0x0A, 0x13, 0x63, 0x63, 0x5F, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x69,
+      0x63, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x18, 0x10, 0x20, 0x01, 0x28, 0x08,
+      0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x11, 0x63, 0x63, 0x47, 0x65, 0x6E, 0x65, 0x72,
+      0x69, 0x63, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x12, 0x39, 0x0A, 0x15, 0x6A, 0x61,
+      0x76, 0x61, 0x5F, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x69,
+      0x63, 0x65, 0x73, 0x18, 0x11, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65,
+      0x52, 0x13, 0x6A, 0x61, 0x76, 0x61, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x53, 0x65, 0x72,
+      0x76, 0x69, 0x63, 0x65, 0x73, 0x12, 0x35, 0x0A, 0x13, 0x70, 0x79, 0x5F, 0x67, 0x65, 0x6E, 0x65,
+      0x72, 0x69, 0x63, 0x5F, 0x73, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x18, 0x12, 0x20, 0x01,
+      0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x11, 0x70, 0x79, 0x47, 0x65, 0x6E,
+      0x65, 0x72, 0x69, 0x63, 0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x73, 0x12, 0x37, 0x0A, 0x14,
+      0x70, 0x68, 0x70, 0x5F, 0x67, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x5F, 0x73, 0x65, 0x72, 0x76,
+      0x69, 0x63, 0x65, 0x73, 0x18, 0x2A, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73,
+      0x65, 0x52, 0x12, 0x70, 0x68, 0x70, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x69, 0x63, 0x53, 0x65, 0x72,
+      0x76, 0x69, 0x63, 0x65, 0x73, 0x12, 0x25, 0x0A, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61,
+      0x74, 0x65, 0x64, 0x18, 0x17, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65,
+      0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x12, 0x2E, 0x0A, 0x10,
+      0x63, 0x63, 0x5F, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x5F, 0x61, 0x72, 0x65, 0x6E, 0x61, 0x73,
+      0x18, 0x1F, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x04, 0x74, 0x72, 0x75, 0x65, 0x52, 0x0E, 0x63, 0x63,
+      0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x41, 0x72, 0x65, 0x6E, 0x61, 0x73, 0x12, 0x2A, 0x0A, 0x11,
+      0x6F, 0x62, 0x6A, 0x63, 0x5F, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x66, 0x69,
+      0x78, 0x18, 0x24, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0F, 0x6F, 0x62, 0x6A, 0x63, 0x43, 0x6C, 0x61,
+      0x73, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x12, 0x29, 0x0A, 0x10, 0x63, 0x73, 0x68, 0x61,
+      0x72, 0x70, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x18, 0x25, 0x20, 0x01,
+      0x28, 0x09, 0x52, 0x0F, 0x63, 0x73, 0x68, 0x61, 0x72, 0x70, 0x4E, 0x61, 0x6D, 0x65, 0x73, 0x70,
+      0x61, 0x63, 0x65, 0x12, 0x21, 0x0A, 0x0C, 0x73, 0x77, 0x69, 0x66, 0x74, 0x5F, 0x70, 0x72, 0x65,
+      0x66, 0x69, 0x78, 0x18, 0x27, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0B, 0x73, 0x77, 0x69, 0x66, 0x74,
+      0x50, 0x72, 0x65, 0x66, 0x69, 0x78, 0x12, 0x28, 0x0A, 0x10, 0x70, 0x68, 0x70, 0x5F, 0x63, 0x6C,
+      0x61, 0x73, 0x73, 0x5F, 0x70, 0x72, 0x65, 0x66, 0x69, 0x78, 0x18, 0x28, 0x20, 0x01, 0x28, 0x09,
+      0x52, 0x0E, 0x70, 0x68, 0x70, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x50, 0x72, 0x65, 0x66, 0x69, 0x78,
+      0x12, 0x23, 0x0A, 0x0D, 0x70, 0x68, 0x70, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63,
+      0x65, 0x18, 0x29, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0C, 0x70, 0x68, 0x70, 0x4E, 0x61, 0x6D, 0x65,
+      0x73, 0x70, 0x61, 0x63, 0x65, 0x12, 0x34, 0x0A, 0x16, 0x70, 0x68, 0x70, 0x5F, 0x6D, 0x65, 0x74,
+      0x61, 0x64, 0x61, 0x74, 0x61, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x18,
+      0x2C, 0x20, 0x01, 0x28, 0x09, 0x52, 0x14, 0x70, 0x68, 0x70, 0x4D, 0x65, 0x74, 0x61, 0x64, 0x61,
+      0x74, 0x61, 0x4E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x12, 0x21, 0x0A, 0x0C, 0x72,
+      0x75, 0x62, 0x79, 0x5F, 0x70, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x18, 0x2D, 0x20, 0x01, 0x28,
+      0x09, 0x52, 0x0B, 0x72, 0x75, 0x62, 0x79, 0x50, 0x61, 0x63, 0x6B, 0x61, 0x67, 0x65, 0x12, 0x58,
+      0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x5F,
+      0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74,
+      0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74,
+      0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3A, 0x0A, 0x0C, 0x4F, 0x70, 0x74, 0x69,
+      0x6D, 0x69, 0x7A, 0x65, 0x4D, 0x6F, 0x64, 0x65, 0x12, 0x09, 0x0A, 0x05, 0x53, 0x50, 0x45, 0x45,
+      0x44, 0x10, 0x01, 0x12, 0x0D, 0x0A, 0x09, 0x43, 0x4F, 0x44, 0x45, 0x5F, 0x53, 0x49, 0x5A, 0x45,
+      0x10, 0x02, 0x12, 0x10, 0x0A, 0x0C, 0x4C, 0x49, 0x54, 0x45, 0x5F, 0x52, 0x55, 0x4E, 0x54, 0x49,
+      0x4D, 0x45, 0x10, 0x03, 0x2A, 0x09, 0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x4A,
+      0x04, 0x08, 0x26, 0x10, 0x27, 0x22, 0xE3, 0x02, 0x0A, 0x0E, 0x4D, 0x65, 0x73, 0x73, 0x61, 0x67,
+      0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x3C, 0x0A, 0x17, 0x6D, 0x65, 0x73, 0x73,
+      0x61, 0x67, 0x65, 0x5F, 0x73, 0x65, 0x74, 0x5F, 0x77, 0x69, 0x72, 0x65, 0x5F, 0x66, 0x6F, 0x72,
+      0x6D, 0x61, 0x74, 0x18, 0x01, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65,
+      0x52, 0x14, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x53, 0x65, 0x74, 0x57, 0x69, 0x72, 0x65,
+      0x46, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x12, 0x4C, 0x0A, 0x1F, 0x6E, 0x6F, 0x5F, 0x73, 0x74, 0x61,
+      0x6E, 0x64, 0x61, 0x72, 0x64, 0x5F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72,
+      0x5F, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x6F, 0x72, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x3A,
+      0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x1C, 0x6E, 0x6F, 0x53, 0x74, 0x61, 0x6E, 0x64, 0x61,
+      0x72, 0x64, 0x44, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x41, 0x63, 0x63, 0x65,
+      0x73, 0x73, 0x6F, 0x72, 0x12, 0x25, 0x0A, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74,
+      0x65, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52,
+      0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x12, 0x1B, 0x0A, 0x09, 0x6D,
+      0x61, 0x70, 0x5F, 0x65, 0x6E, 0x74, 0x72, 0x79, 0x18, 0x07, 0x20, 0x01, 0x28, 0x08, 0x52, 0x08,
+      0x6D, 0x61, 0x70, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E,
+      0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65,
+      0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75,
+      0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x2A, 0x09, 0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x4A, 0x04, 0x08,
+      0x04, 0x10, 0x05, 0x4A, 0x04, 0x08, 0x05, 0x10, 0x06, 0x4A, 0x04, 0x08, 0x06, 0x10, 0x07, 0x4A,
+      0x04, 0x08, 0x08, 0x10, 0x09, 0x4A, 0x04, 0x08, 0x09, 0x10, 0x0A, 0x22, 0x92, 0x04, 0x0A, 0x0C,
+      0x46, 0x69, 0x65, 0x6C, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x41, 0x0A, 0x05,
+      0x63, 0x74, 0x79, 0x70, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x23, 0x2E, 0x67, 0x6F,
+      0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69,
+      0x65, 0x6C, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x43, 0x54, 0x79, 0x70, 0x65,
+      0x3A, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x52, 0x05, 0x63, 0x74, 0x79, 0x70, 0x65, 0x12,
+      0x16, 0x0A, 0x06, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x52,
+      0x06, 0x70, 0x61, 0x63, 0x6B, 0x65, 0x64, 0x12, 0x47, 0x0A, 0x06, 0x6A, 0x73, 0x74, 0x79, 0x70,
+      0x65, 0x18, 0x06, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x4F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x4A, 0x53, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x09, 0x4A,
+      0x53, 0x5F, 0x4E, 0x4F, 0x52, 0x4D, 0x41, 0x4C, 0x52, 0x06, 0x6A, 0x73, 0x74, 0x79, 0x70, 0x65,
+      0x12, 0x19, 0x0A, 0x04, 0x6C, 0x61, 0x7A, 0x79, 0x18, 0x05, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05,
+      0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x04, 0x6C, 0x61, 0x7A, 0x79, 0x12, 0x2E, 0x0A, 0x0F, 0x75,
+      0x6E, 0x76, 0x65, 0x72, 0x69, 0x66, 0x69, 0x65, 0x64, 0x5F, 0x6C, 0x61, 0x7A, 0x79, 0x18, 0x0F,
+      0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0E, 0x75, 0x6E, 0x76,
+      0x65, 0x72, 0x69, 0x66, 0x69, 0x65, 0x64, 0x4C, 0x61, 0x7A, 0x79, 0x12, 0x25, 0x0A, 0x0A, 0x64,
+      0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3A,
+      0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74,
+      0x65, 0x64, 0x12, 0x19, 0x0A, 0x04, 0x77, 0x65, 0x61, 0x6B, 0x18, 0x0A, 0x20, 0x01, 0x28, 0x08,
+      0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x04, 0x77, 0x65, 0x61, 0x6B, 0x12, 0x58, 0x0A,
+      0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55,
+      0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65,
+      0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x2F, 0x0A, 0x05, 0x43, 0x54, 0x79, 0x70, 0x65,
+      0x12, 0x0A, 0x0A, 0x06, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x10, 0x00, 0x12, 0x08, 0x0A, 0x04,
+      0x43, 0x4F, 0x52, 0x44, 0x10, 0x01, 0x12, 0x10, 0x0A, 0x0C, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47,
+      0x5F, 0x50, 0x49, 0x45, 0x43, 0x45, 0x10, 0x02, 0x22, 0x35, 0x0A, 0x06, 0x4A, 0x53, 0x54, 0x79,
+      0x70, 0x65, 0x12, 0x0D, 0x0A, 0x09, 0x4A, 0x53, 0x5F, 0x4E, 0x4F, 0x52, 0x4D, 0x41, 0x4C, 0x10,
+      0x00, 0x12, 0x0D, 0x0A, 0x09, 0x4A, 0x53, 0x5F, 0x53, 0x54, 0x52, 0x49, 0x4E, 0x47, 0x10, 0x01,
+      0x12, 0x0D, 0x0A, 0x09, 0x4A, 0x53, 0x5F, 0x4E, 0x55, 0x4D, 0x42, 0x45, 0x52, 0x10, 0x02, 0x2A,
+      0x09, 0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x4A, 0x04, 0x08, 0x04, 0x10, 0x05,
+      0x22, 0x73, 0x0A, 0x0C, 0x4F, 0x6E, 0x65, 0x6F, 0x66, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73,
+      0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65,
+      0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32,
+      0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75,
+      0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72,
+      0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x09, 0x08, 0xE8, 0x07, 0x10,
+      0x80, 0x80, 0x80, 0x80, 0x02, 0x22, 0xC0, 0x01, 0x0A, 0x0B, 0x45, 0x6E, 0x75, 0x6D, 0x4F, 0x70,
+      0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x1F, 0x0A, 0x0B, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x5F, 0x61,
+      0x6C, 0x69, 0x61, 0x73, 0x18, 0x02, 0x20, 0x01, 0x28, 0x08, 0x52, 0x0A, 0x61, 0x6C, 0x6C, 0x6F,
+      0x77, 0x41, 0x6C, 0x69, 0x61, 0x73, 0x12, 0x25, 0x0A, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63,
+      0x61, 0x74, 0x65, 0x64, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73,
+      0x65, 0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x12, 0x58, 0x0A,
+      0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55,
+      0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65,
+      0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x09, 0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80,
+      0x80, 0x02, 0x4A, 0x04, 0x08, 0x05, 0x10, 0x06, 0x22, 0x9E, 0x01, 0x0A, 0x10, 0x45, 0x6E, 0x75,
+      0x6D, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x25, 0x0A,
+      0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x18, 0x01, 0x20, 0x01, 0x28,
+      0x08, 0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63,
+      0x61, 0x74, 0x65, 0x64, 0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70,
+      0x72, 0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20,
+      0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65,
+      0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74,
+      0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x09,
+      0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x22, 0x9C, 0x01, 0x0A, 0x0E, 0x53, 0x65,
+      0x72, 0x76, 0x69, 0x63, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x25, 0x0A, 0x0A,
+      0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x18, 0x21, 0x20, 0x01, 0x28, 0x08,
+      0x3A, 0x05, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61,
+      0x74, 0x65, 0x64, 0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72,
+      0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20, 0x03,
+      0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74,
+      0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65,
+      0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x09, 0x08,
+      0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x22, 0xE0, 0x02, 0x0A, 0x0D, 0x4D, 0x65, 0x74,
+      0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x12, 0x25, 0x0A, 0x0A, 0x64, 0x65,
+      0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65, 0x64, 0x18, 0x21, 0x20, 0x01, 0x28, 0x08, 0x3A, 0x05,
+      0x66, 0x61, 0x6C, 0x73, 0x65, 0x52, 0x0A, 0x64, 0x65, 0x70, 0x72, 0x65, 0x63, 0x61, 0x74, 0x65,
+      0x64, 0x12, 0x71, 0x0A, 0x11, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x63, 0x79,
+      0x5F, 0x6C, 0x65, 0x76, 0x65, 0x6C, 0x18, 0x22, 0x20, 0x01, 0x28, 0x0E, 0x32, 0x2F, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D,
+      0x65, 0x74, 0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x49, 0x64, 0x65,
+      0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x4C, 0x65, 0x76, 0x65, 0x6C, 0x3A, 0x13, 0x49,
+      0x44, 0x45, 0x4D, 0x50, 0x4F, 0x54, 0x45, 0x4E, 0x43, 0x59, 0x5F, 0x55, 0x4E, 0x4B, 0x4E, 0x4F,
+      0x57, 0x4E, 0x52, 0x10, 0x69, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x4C,
+      0x65, 0x76, 0x65, 0x6C, 0x12, 0x58, 0x0A, 0x14, 0x75, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70,
+      0x72, 0x65, 0x74, 0x65, 0x64, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0xE7, 0x07, 0x20,
+      0x03, 0x28, 0x0B, 0x32, 0x24, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65,
+      0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x13, 0x75, 0x6E, 0x69, 0x6E, 0x74,
+      0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x50,
+      0x0A, 0x10, 0x49, 0x64, 0x65, 0x6D, 0x70, 0x6F, 0x74, 0x65, 0x6E, 0x63, 0x79, 0x4C, 0x65, 0x76,
+      0x65, 0x6C, 0x12, 0x17, 0x0A, 0x13, 0x49, 0x44, 0x45, 0x4D, 0x50, 0x4F, 0x54, 0x45, 0x4E, 0x43,
+      0x59, 0x5F, 0x55, 0x4E, 0x4B, 0x4E, 0x4F, 0x57, 0x4E, 0x10, 0x00, 0x12, 0x13, 0x0A, 0x0F, 0x4E,
+      0x4F, 0x5F, 0x53, 0x49, 0x44, 0x45, 0x5F, 0x45, 0x46, 0x46, 0x45, 0x43, 0x54, 0x53, 0x10, 0x01,
+      0x12, 0x0E, 0x0A, 0x0A, 0x49, 0x44, 0x45, 0x4D, 0x50, 0x4F, 0x54, 0x45, 0x4E, 0x54, 0x10, 0x02,
+      0x2A, 0x09, 0x08, 0xE8, 0x07, 0x10, 0x80, 0x80, 0x80, 0x80, 0x02, 0x22, 0x9A, 0x03, 0x0A, 0x13,
+      0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65, 0x64, 0x4F, 0x70, 0x74,
+      0x69, 0x6F, 0x6E, 0x12, 0x41, 0x0A, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x02, 0x20, 0x03, 0x28,
+      0x0B, 0x32, 0x2D, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+      0x62, 0x75, 0x66, 0x2E, 0x55, 0x6E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x70, 0x72, 0x65, 0x74, 0x65,
+      0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x4E, 0x61, 0x6D, 0x65, 0x50, 0x61, 0x72, 0x74,
+      0x52, 0x04, 0x6E, 0x61, 0x6D, 0x65, 0x12, 0x29, 0x0A, 0x10, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69,
+      0x66, 0x69, 0x65, 0x72, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09,
+      0x52, 0x0F, 0x69, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x66, 0x69, 0x65, 0x72, 0x56, 0x61, 0x6C, 0x75,
+      0x65, 0x12, 0x2C, 0x0A, 0x12, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x69, 0x6E,
+      0x74, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x04, 0x20, 0x01, 0x28, 0x04, 0x52, 0x10, 0x70,
+      0x6F, 0x73, 0x69, 0x74, 0x69, 0x76, 0x65, 0x49, 0x6E, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12,
+      0x2C, 0x0A, 0x12, 0x6E, 0x65, 0x67, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5F, 0x69, 0x6E, 0x74, 0x5F,
+      0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x05, 0x20, 0x01, 0x28, 0x03, 0x52, 0x10, 0x6E, 0x65, 0x67,
+      0x61, 0x74, 0x69, 0x76, 0x65, 0x49, 0x6E, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x21, 0x0A,
+      0x0C, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x06, 0x20,
+      0x01, 0x28, 0x01, 0x52, 0x0B, 0x64, 0x6F, 0x75, 0x62, 0x6C, 0x65, 0x56, 0x61, 0x6C, 0x75, 0x65,
+      0x12, 0x21, 0x0A, 0x0C, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65,
+      0x18, 0x07, 0x20, 0x01, 0x28, 0x0C, 0x52, 0x0B, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x56, 0x61,
+      0x6C, 0x75, 0x65, 0x12, 0x27, 0x0A, 0x0F, 0x61, 0x67, 0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65,
+      0x5F, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x08, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0E, 0x61, 0x67,
+      0x67, 0x72, 0x65, 0x67, 0x61, 0x74, 0x65, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x1A, 0x4A, 0x0A, 0x08,
+      0x4E, 0x61, 0x6D, 0x65, 0x50, 0x61, 0x72, 0x74, 0x12, 0x1B, 0x0A, 0x09, 0x6E, 0x61, 0x6D, 0x65,
+      0x5F, 0x70, 0x61, 0x72, 0x74, 0x18, 0x01, 0x20, 0x02, 0x28, 0x09, 0x52, 0x08, 0x6E, 0x61, 0x6D,
+      0x65, 0x50, 0x61, 0x72, 0x74, 0x12, 0x21, 0x0A, 0x0C, 0x69, 0x73, 0x5F, 0x65, 0x78, 0x74, 0x65,
+      0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x18, 0x02, 0x20, 0x02, 0x28, 0x08, 0x52, 0x0B, 0x69, 0x73, 0x45,
+      0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0xA7, 0x02, 0x0A, 0x0E, 0x53, 0x6F, 0x75,
+      0x72, 0x63, 0x65, 0x43, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x12, 0x44, 0x0A, 0x08, 0x6C,
+      0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x28, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x53, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x43, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x2E, 0x4C,
+      0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x08, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F,
+      0x6E, 0x1A, 0xCE, 0x01, 0x0A, 0x08, 0x4C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x12, 0x16,
+      0x0A, 0x04, 0x70, 0x61, 0x74, 0x68, 0x18, 0x01, 0x20, 0x03, 0x28, 0x05, 0x42, 0x02, 0x10, 0x01,
+      0x52, 0x04, 0x70, 0x61, 0x74, 0x68, 0x12, 0x16, 0x0A, 0x04, 0x73, 0x70, 0x61, 0x6E, 0x18, 0x02,
+      0x20, 0x03, 0x28, 0x05, 0x42, 0x02, 0x10, 0x01, 0x52, 0x04, 0x73, 0x70, 0x61, 0x6E, 0x12, 0x29,
+      0x0A, 0x10, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E,
+      0x74, 0x73, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0F, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E,
+      0x67, 0x43, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x12, 0x2B, 0x0A, 0x11, 0x74, 0x72, 0x61,
+      0x69, 0x6C, 0x69, 0x6E, 0x67, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x18, 0x04,
+      0x20, 0x01, 0x28, 0x09, 0x52, 0x10, 0x74, 0x72, 0x61, 0x69, 0x6C, 0x69, 0x6E, 0x67, 0x43, 0x6F,
+      0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x12, 0x3A, 0x0A, 0x19, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E,
+      0x67, 0x5F, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x5F, 0x63, 0x6F, 0x6D, 0x6D, 0x65,
+      0x6E, 0x74, 0x73, 0x18, 0x06, 0x20, 0x03, 0x28, 0x09, 0x52, 0x17, 0x6C, 0x65, 0x61, 0x64, 0x69,
+      0x6E, 0x67, 0x44, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x43, 0x6F, 0x6D, 0x6D, 0x65, 0x6E,
+      0x74, 0x73, 0x22, 0xD1, 0x01, 0x0A, 0x11, 0x47, 0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64,
+      0x43, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F, 0x12, 0x4D, 0x0A, 0x0A, 0x61, 0x6E, 0x6E, 0x6F,
+      0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x18, 0x01, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x2D, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x47,
+      0x65, 0x6E, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x43, 0x6F, 0x64, 0x65, 0x49, 0x6E, 0x66, 0x6F,
+      0x2E, 0x41, 0x6E, 0x6E, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x52, 0x0A, 0x61, 0x6E, 0x6E,
+      0x6F, 0x74, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x1A, 0x6D, 0x0A, 0x0A, 0x41, 0x6E, 0x6E, 0x6F, 0x74,
+      0x61, 0x74, 0x69, 0x6F, 0x6E, 0x12, 0x16, 0x0A, 0x04, 0x70, 0x61, 0x74, 0x68, 0x18, 0x01, 0x20,
+      0x03, 0x28, 0x05, 0x42, 0x02, 0x10, 0x01, 0x52, 0x04, 0x70, 0x61, 0x74, 0x68, 0x12, 0x1F, 0x0A,
+      0x0B, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x66, 0x69, 0x6C, 0x65, 0x18, 0x02, 0x20, 0x01,
+      0x28, 0x09, 0x52, 0x0A, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x46, 0x69, 0x6C, 0x65, 0x12, 0x14,
+      0x0A, 0x05, 0x62, 0x65, 0x67, 0x69, 0x6E, 0x18, 0x03, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x62,
+      0x65, 0x67, 0x69, 0x6E, 0x12, 0x10, 0x0A, 0x03, 0x65, 0x6E, 0x64, 0x18, 0x04, 0x20, 0x01, 0x28,
+      0x05, 0x52, 0x03, 0x65, 0x6E, 0x64, 0x42, 0x7E, 0x0A, 0x13, 0x63, 0x6F, 0x6D, 0x2E, 0x67, 0x6F,
+      0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x42, 0x10, 0x44,
+      0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x73, 0x48,
+      0x01, 0x5A, 0x2D, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x67, 0x6F, 0x6C, 0x61, 0x6E, 0x67,
+      0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x74, 0x79,
+      0x70, 0x65, 0x73, 0x2F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x70, 0x62,
+      0xF8, 0x01, 0x01, 0xA2, 0x02, 0x03, 0x47, 0x50, 0x42, 0xAA, 0x02, 0x1A, 0x47, 0x6F, 0x6F, 0x67,
+      0x6C, 0x65, 0x2E, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x52, 0x65, 0x66, 0x6C,
+      0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x0A, 0xBB, 0x04, 0x0A, 0x12, 0x61, 0x65, 0x6C, 0x66, 0x5F,
+      0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x04, 0x61,
+      0x65, 0x6C, 0x66, 0x1A, 0x20, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2F, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2F, 0x64, 0x65, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x6F, 0x72, 0x2E,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x3A, 0x35, 0x0A, 0x04, 0x62, 0x61, 0x73, 0x65, 0x12, 0x1F, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x53, 0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0xA9,
+      0xE9, 0x1E, 0x20, 0x03, 0x28, 0x09, 0x52, 0x04, 0x62, 0x61, 0x73, 0x65, 0x3A, 0x44, 0x0A, 0x0C,
+      0x63, 0x73, 0x68, 0x61, 0x72, 0x70, 0x5F, 0x73, 0x74, 0x61, 0x74, 0x65, 0x12, 0x1F, 0x2E, 0x67,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x53,
+      0x65, 0x72, 0x76, 0x69, 0x63, 0x65, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0xC6, 0xE9,
+      0x1E, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0B, 0x63, 0x73, 0x68, 0x61, 0x72, 0x70, 0x53, 0x74, 0x61,
+      0x74, 0x65, 0x3A, 0x39, 0x0A, 0x07, 0x69, 0x73, 0x5F, 0x76, 0x69, 0x65, 0x77, 0x12, 0x1E, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x91, 0xF1,
+      0x1E, 0x20, 0x01, 0x28, 0x08, 0x52, 0x06, 0x69, 0x73, 0x56, 0x69, 0x65, 0x77, 0x3A, 0x3B, 0x0A,
+      0x08, 0x62, 0x61, 0x73, 0x65, 0x5F, 0x66, 0x65, 0x65, 0x12, 0x1E, 0x2E, 0x67, 0x6F, 0x6F, 0x67,
+      0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D, 0x65, 0x74, 0x68,
+      0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x92, 0xF1, 0x1E, 0x20, 0x01, 0x28,
+      0x03, 0x52, 0x07, 0x62, 0x61, 0x73, 0x65, 0x46, 0x65, 0x65, 0x3A, 0x49, 0x0A, 0x0F, 0x72, 0x65,
+      0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x5F, 0x77, 0x65, 0x69, 0x67, 0x68, 0x74, 0x12, 0x1E, 0x2E,
+      0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E,
+      0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x18, 0x93, 0xF1,
+      0x1E, 0x20, 0x03, 0x28, 0x09, 0x52, 0x0E, 0x72, 0x65, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x57,
+      0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x3F, 0x0A, 0x0A, 0x70, 0x6F, 0x6F, 0x6C, 0x5F, 0x69, 0x6E,
+      0x70, 0x75, 0x74, 0x12, 0x1E, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x73, 0x18, 0x94, 0xF1, 0x1E, 0x20, 0x01, 0x28, 0x08, 0x52, 0x09, 0x70, 0x6F, 0x6F,
+      0x6C, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x3C, 0x0A, 0x08, 0x69, 0x73, 0x5F, 0x65, 0x76, 0x65,
+      0x6E, 0x74, 0x12, 0x1F, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2E, 0x4D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x4F, 0x70, 0x74, 0x69,
+      0x6F, 0x6E, 0x73, 0x18, 0xB4, 0x87, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x07, 0x69, 0x73, 0x45,
+      0x76, 0x65, 0x6E, 0x74, 0x3A, 0x3E, 0x0A, 0x0A, 0x69, 0x73, 0x5F, 0x69, 0x6E, 0x64, 0x65, 0x78,
+      0x65, 0x64, 0x12, 0x1D, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x62, 0x75, 0x66, 0x2E, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x73, 0x18, 0xF1, 0xD1, 0x1E, 0x20, 0x01, 0x28, 0x08, 0x52, 0x09, 0x69, 0x73, 0x49, 0x6E, 0x64,
+      0x65, 0x78, 0x65, 0x64, 0x0A, 0xBE, 0x01, 0x0A, 0x1B, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2F,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x12, 0x0F, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x22, 0x07, 0x0A, 0x05, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x42, 0x7D,
+      0x0A, 0x13, 0x63, 0x6F, 0x6D, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x42, 0x0A, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x50, 0x72, 0x6F, 0x74,
+      0x6F, 0x50, 0x01, 0x5A, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x67, 0x6F, 0x6C, 0x61,
+      0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F,
+      0x74, 0x79, 0x70, 0x65, 0x73, 0x2F, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x2F, 0x65, 0x6D, 0x70, 0x74,
+      0x79, 0x70, 0x62, 0xF8, 0x01, 0x01, 0xA2, 0x02, 0x03, 0x47, 0x50, 0x42, 0xAA, 0x02, 0x1E, 0x47,
+      0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x57,
+      0x65, 0x6C, 0x6C, 0x4B, 0x6E, 0x6F, 0x77, 0x6E, 0x54, 0x79, 0x70, 0x65, 0x73, 0x62, 0x06, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x33, 0x0A, 0x86, 0x04, 0x0A, 0x1E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2F, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65,
+      0x72, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x0F, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x22, 0x23, 0x0A, 0x0B, 0x44, 0x6F, 0x75,
+      0x62, 0x6C, 0x65, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75,
+      0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x22,
+      0x0A, 0x0A, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05,
+      0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x02, 0x52, 0x05, 0x76, 0x61, 0x6C,
+      0x75, 0x65, 0x22, 0x22, 0x0A, 0x0A, 0x49, 0x6E, 0x74, 0x36, 0x34, 0x56, 0x61, 0x6C, 0x75, 0x65,
+      0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x03, 0x52,
+      0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x23, 0x0A, 0x0B, 0x55, 0x49, 0x6E, 0x74, 0x36, 0x34,
+      0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x01,
+      0x20, 0x01, 0x28, 0x04, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x22, 0x0A, 0x0A, 0x49,
+      0x6E, 0x74, 0x33, 0x32, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C,
+      0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x05, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22,
+      0x23, 0x0A, 0x0B, 0x55, 0x49, 0x6E, 0x74, 0x33, 0x32, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14,
+      0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0D, 0x52, 0x05, 0x76,
+      0x61, 0x6C, 0x75, 0x65, 0x22, 0x21, 0x0A, 0x09, 0x42, 0x6F, 0x6F, 0x6C, 0x56, 0x61, 0x6C, 0x75,
+      0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x08,
+      0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x23, 0x0A, 0x0B, 0x53, 0x74, 0x72, 0x69, 0x6E,
+      0x67, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x18,
+      0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x22, 0x0A, 0x0A,
+      0x42, 0x79, 0x74, 0x65, 0x73, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x12, 0x14, 0x0A, 0x05, 0x76, 0x61,
+      0x6C, 0x75, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x0C, 0x52, 0x05, 0x76, 0x61, 0x6C, 0x75, 0x65,
+      0x42, 0x83, 0x01, 0x0A, 0x13, 0x63, 0x6F, 0x6D, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x42, 0x0D, 0x57, 0x72, 0x61, 0x70, 0x70, 0x65,
+      0x72, 0x73, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x50, 0x01, 0x5A, 0x31, 0x67, 0x6F, 0x6F, 0x67, 0x6C,
+      0x65, 0x2E, 0x67, 0x6F, 0x6C, 0x61, 0x6E, 0x67, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x74, 0x79, 0x70, 0x65, 0x73, 0x2F, 0x6B, 0x6E, 0x6F, 0x77,
+      0x6E, 0x2F, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x73, 0x70, 0x62, 0xF8, 0x01, 0x01, 0xA2,
+      0x02, 0x03, 0x47, 0x50, 0x42, 0xAA, 0x02, 0x1E, 0x47, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x50,
+      0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x57, 0x65, 0x6C, 0x6C, 0x4B, 0x6E, 0x6F, 0x77,
+      0x6E, 0x54, 0x79, 0x70, 0x65, 0x73, 0x62, 0x06, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x33, 0x0A, 0xF0,
+      0x04, 0x0A, 0x0A, 0x61, 0x63, 0x73, 0x31, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x12, 0x04, 0x61,
+      0x63, 0x73, 0x31, 0x1A, 0x12, 0x61, 0x65, 0x6C, 0x66, 0x5F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E,
+      0x73, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x1B, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2F,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x1E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2F, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x77, 0x72, 0x61, 0x70, 0x70, 0x65, 0x72, 0x73, 0x2E, 0x70,
+      0x72, 0x6F, 0x74, 0x6F, 0x22, 0x7B, 0x0A, 0x0A, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65,
+      0x65, 0x73, 0x12, 0x1F, 0x0A, 0x0B, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x5F, 0x6E, 0x61, 0x6D,
+      0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4E,
+      0x61, 0x6D, 0x65, 0x12, 0x23, 0x0A, 0x04, 0x66, 0x65, 0x65, 0x73, 0x18, 0x02, 0x20, 0x03, 0x28,
+      0x0B, 0x32, 0x0F, 0x2E, 0x61, 0x63, 0x73, 0x31, 0x2E, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46,
+      0x65, 0x65, 0x52, 0x04, 0x66, 0x65, 0x65, 0x73, 0x12, 0x27, 0x0A, 0x10, 0x69, 0x73, 0x5F, 0x73,
+      0x69, 0x7A, 0x65, 0x5F, 0x66, 0x65, 0x65, 0x5F, 0x66, 0x72, 0x65, 0x65, 0x18, 0x03, 0x20, 0x01,
+      0x28, 0x08, 0x52, 0x0D, 0x69, 0x73, 0x53, 0x69, 0x7A, 0x65, 0x46, 0x65, 0x65, 0x46, 0x72, 0x65,
+      0x65, 0x22, 0x40, 0x0A, 0x09, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65, 0x12, 0x16,
+      0x0A, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x06,
+      0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x12, 0x1B, 0x0A, 0x09, 0x62, 0x61, 0x73, 0x69, 0x63, 0x5F,
+      0x66, 0x65, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x08, 0x62, 0x61, 0x73, 0x69, 0x63,
+      0x46, 0x65, 0x65, 0x22, 0x52, 0x0A, 0x10, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65,
+      0x43, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x12, 0x26, 0x0A, 0x0B, 0x6D, 0x65, 0x74, 0x68, 0x6F,
+      0x64, 0x5F, 0x6E, 0x61, 0x6D, 0x65, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x42, 0x05, 0x88, 0x8F,
+      0xF5, 0x01, 0x01, 0x52, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x4E, 0x61, 0x6D, 0x65, 0x12,
+      0x10, 0x0A, 0x03, 0x66, 0x65, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x03, 0x66, 0x65,
+      0x65, 0x3A, 0x04, 0xA0, 0xBB, 0x18, 0x01, 0x32, 0xD7, 0x01, 0x0A, 0x19, 0x4D, 0x65, 0x74, 0x68,
+      0x6F, 0x64, 0x46, 0x65, 0x65, 0x50, 0x72, 0x6F, 0x76, 0x69, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6E,
+      0x74, 0x72, 0x61, 0x63, 0x74, 0x12, 0x3A, 0x0A, 0x0C, 0x53, 0x65, 0x74, 0x4D, 0x65, 0x74, 0x68,
+      0x6F, 0x64, 0x46, 0x65, 0x65, 0x12, 0x10, 0x2E, 0x61, 0x63, 0x73, 0x31, 0x2E, 0x4D, 0x65, 0x74,
+      0x68, 0x6F, 0x64, 0x46, 0x65, 0x65, 0x73, 0x1A, 0x16, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x22,
+      0x00, 0x12, 0x45, 0x0A, 0x0C, 0x47, 0x65, 0x74, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65,
+      0x65, 0x12, 0x1C, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+      0x62, 0x75, 0x66, 0x2E, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x1A,
+      0x10, 0x2E, 0x61, 0x63, 0x73, 0x31, 0x2E, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65,
+      0x73, 0x22, 0x05, 0x88, 0x89, 0xF7, 0x01, 0x01, 0x1A, 0x37, 0xB2, 0xCC, 0xF6, 0x01, 0x32, 0x41,
+      0x45, 0x6C, 0x66, 0x2E, 0x53, 0x74, 0x61, 0x6E, 0x64, 0x61, 0x72, 0x64, 0x73, 0x2E, 0x41, 0x43,
+      0x53, 0x31, 0x2E, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65, 0x50, 0x72, 0x6F, 0x76,
+      0x69, 0x64, 0x65, 0x72, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x53, 0x74, 0x61, 0x74,
+      0x65, 0x42, 0x16, 0xAA, 0x02, 0x13, 0x41, 0x45, 0x6C, 0x66, 0x2E, 0x53, 0x74, 0x61, 0x6E, 0x64,
+      0x61, 0x72, 0x64, 0x73, 0x2E, 0x41, 0x43, 0x53, 0x31, 0x62, 0x06, 0x70, 0x72, 0x6F, 0x74, 0x6F,
+      0x33, 0x0A, 0x9E, 0x0B, 0x0A, 0x0B, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x12, 0x05, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x1A, 0x12, 0x61, 0x65, 0x6C, 0x66, 0x5F, 0x6F,
+      0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x0A, 0x61, 0x63,
+      0x73, 0x31, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x1A, 0x1B, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65,
+      0x2F, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62, 0x75, 0x66, 0x2F, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E,
+      0x70, 0x72, 0x6F, 0x74, 0x6F, 0x22, 0x63, 0x0A, 0x0D, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65,
+      0x72, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x12, 0x0E, 0x0A, 0x02, 0x74, 0x6F, 0x18, 0x01, 0x20, 0x01,
+      0x28, 0x09, 0x52, 0x02, 0x74, 0x6F, 0x12, 0x16, 0x0A, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C,
+      0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x12, 0x16,
+      0x0A, 0x06, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06,
+      0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x12, 0x12, 0x0A, 0x04, 0x6D, 0x65, 0x6D, 0x6F, 0x18, 0x04,
+      0x20, 0x01, 0x28, 0x09, 0x52, 0x04, 0x6D, 0x65, 0x6D, 0x6F, 0x22, 0x3F, 0x0A, 0x0F, 0x47, 0x65,
+      0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x12, 0x16, 0x0A,
+      0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x06, 0x73,
+      0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x12, 0x14, 0x0A, 0x05, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x18, 0x02,
+      0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x22, 0x5A, 0x0A, 0x10, 0x47,
+      0x65, 0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x12,
+      0x16, 0x0A, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52,
+      0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x12, 0x14, 0x0A, 0x05, 0x6F, 0x77, 0x6E, 0x65, 0x72,
+      0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x52, 0x05, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x12, 0x18, 0x0A,
+      0x07, 0x62, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x18, 0x03, 0x20, 0x01, 0x28, 0x03, 0x52, 0x07,
+      0x62, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x22, 0xD9, 0x01, 0x0A, 0x0B, 0x54, 0x72, 0x61, 0x6E,
+      0x73, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x12, 0x19, 0x0A, 0x04, 0x66, 0x72, 0x6F, 0x6D, 0x18,
+      0x01, 0x20, 0x01, 0x28, 0x09, 0x42, 0x05, 0x88, 0x8F, 0xF5, 0x01, 0x01, 0x52, 0x04, 0x66, 0x72,
+      0x6F, 0x6D, 0x12, 0x15, 0x0A, 0x02, 0x74, 0x6F, 0x18, 0x02, 0x20, 0x01, 0x28, 0x09, 0x42, 0x05,
+      0x88, 0x8F, 0xF5, 0x01, 0x01, 0x52, 0x02, 0x74, 0x6F, 0x12, 0x1D, 0x0A, 0x06, 0x73, 0x79, 0x6D,
+      0x62, 0x6F, 0x6C, 0x18, 0x03, 0x20, 0x01, 0x28, 0x09, 0x42, 0x05, 0x88, 0x8F, 0xF5, 0x01, 0x01,
+      0x52, 0x06, 0x73, 0x79, 0x6D, 0x62, 0x6F, 0x6C, 0x12, 0x16, 0x0A, 0x06, 0x61, 0x6D, 0x6F, 0x75,
+      0x6E, 0x74, 0x18, 0x04, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74,
+      0x12, 0x12, 0x0A, 0x04, 0x6D, 0x65, 0x6D, 0x6F, 0x18, 0x05, 0x20, 0x01, 0x28, 0x09, 0x52, 0x04,
+      0x6D, 0x65, 0x6D, 0x6F, 0x12, 0x12, 0x0A, 0x04, 0x74, 0x61, 0x67, 0x73, 0x18, 0x06, 0x20, 0x03,
+      0x28, 0x03, 0x52, 0x04, 0x74, 0x61, 0x67, 0x73, 0x12, 0x33, 0x0A, 0x08, 0x73, 0x6E, 0x61, 0x70,
+      0x73, 0x68, 0x6F, 0x74, 0x18, 0x07, 0x20, 0x01, 0x28, 0x0B, 0x32, 0x17, 0x2E, 0x74, 0x6F, 0x6B,
+      0x65, 0x6E, 0x2E, 0x47, 0x65, 0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x4F, 0x75, 0x74,
+      0x70, 0x75, 0x74, 0x52, 0x08, 0x73, 0x6E, 0x61, 0x70, 0x73, 0x68, 0x6F, 0x74, 0x3A, 0x04, 0xA0,
+      0xBB, 0x18, 0x01, 0x22, 0x45, 0x0A, 0x06, 0x42, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x12, 0x1D, 0x0A,
+      0x06, 0x62, 0x75, 0x72, 0x6E, 0x65, 0x72, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x42, 0x05, 0x88,
+      0x8F, 0xF5, 0x01, 0x01, 0x52, 0x06, 0x62, 0x75, 0x72, 0x6E, 0x65, 0x72, 0x12, 0x16, 0x0A, 0x06,
+      0x61, 0x6D, 0x6F, 0x75, 0x6E, 0x74, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x06, 0x61, 0x6D,
+      0x6F, 0x75, 0x6E, 0x74, 0x3A, 0x04, 0xA0, 0xBB, 0x18, 0x01, 0x22, 0x8F, 0x03, 0x0A, 0x07, 0x53,
+      0x65, 0x74, 0x74, 0x6C, 0x65, 0x64, 0x12, 0x14, 0x0A, 0x05, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x18,
+      0x01, 0x20, 0x01, 0x28, 0x0D, 0x52, 0x05, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x12, 0x1B, 0x0A, 0x05,
+      0x64, 0x65, 0x6C, 0x74, 0x61, 0x18, 0x02, 0x20, 0x01, 0x28, 0x12, 0x42, 0x05, 0x88, 0x8F, 0xF5,
+      0x01, 0x01, 0x52, 0x05, 0x64, 0x65, 0x6C, 0x74, 0x61, 0x12, 0x14, 0x0A, 0x05, 0x66, 0x69, 0x6E,
+      0x61, 0x6C, 0x18, 0x03, 0x20, 0x01, 0x28, 0x08, 0x52, 0x05, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x12,
+      0x1A, 0x0A, 0x08, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x18, 0x04, 0x20, 0x01, 0x28,
+      0x07, 0x52, 0x08, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x73, 0x75, 0x6D, 0x12, 0x14, 0x0A, 0x05, 0x72,
+      0x61, 0x74, 0x69, 0x6F, 0x18, 0x05, 0x20, 0x01, 0x28, 0x01, 0x52, 0x05, 0x72, 0x61, 0x74, 0x69,
+      0x6F, 0x12, 0x18, 0x0A, 0x07, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x18, 0x06, 0x20, 0x01,
+      0x28, 0x0C, 0x52, 0x07, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x12, 0x16, 0x0A, 0x06, 0x77,
+      0x65, 0x69, 0x67, 0x68, 0x74, 0x18, 0x07, 0x20, 0x01, 0x28, 0x02, 0x52, 0x06, 0x77, 0x65, 0x69,
+      0x67, 0x68, 0x74, 0x12, 0x1D, 0x0A, 0x06, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x18, 0x08, 0x20,
+      0x01, 0x28, 0x10, 0x42, 0x05, 0x88, 0x8F, 0xF5, 0x01, 0x01, 0x52, 0x06, 0x6F, 0x66, 0x66, 0x73,
+      0x65, 0x74, 0x12, 0x25, 0x0A, 0x04, 0x6B, 0x69, 0x6E, 0x64, 0x18, 0x09, 0x20, 0x01, 0x28, 0x0E,
+      0x32, 0x11, 0x2E, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x53, 0x65, 0x74, 0x74, 0x6C, 0x65, 0x4B,
+      0x69, 0x6E, 0x64, 0x52, 0x04, 0x6B, 0x69, 0x6E, 0x64, 0x12, 0x38, 0x0A, 0x08, 0x62, 0x61, 0x6C,
+      0x61, 0x6E, 0x63, 0x65, 0x73, 0x18, 0x0A, 0x20, 0x03, 0x28, 0x0B, 0x32, 0x1C, 0x2E, 0x74, 0x6F,
+      0x6B, 0x65, 0x6E, 0x2E, 0x53, 0x65, 0x74, 0x74, 0x6C, 0x65, 0x64, 0x2E, 0x42, 0x61, 0x6C, 0x61,
+      0x6E, 0x63, 0x65, 0x73, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x52, 0x08, 0x62, 0x61, 0x6C, 0x61, 0x6E,
+      0x63, 0x65, 0x73, 0x12, 0x14, 0x0A, 0x05, 0x73, 0x68, 0x69, 0x66, 0x74, 0x18, 0x0B, 0x20, 0x01,
+      0x28, 0x11, 0x52, 0x05, 0x73, 0x68, 0x69, 0x66, 0x74, 0x1A, 0x3B, 0x0A, 0x0D, 0x42, 0x61, 0x6C,
+      0x61, 0x6E, 0x63, 0x65, 0x73, 0x45, 0x6E, 0x74, 0x72, 0x79, 0x12, 0x10, 0x0A, 0x03, 0x6B, 0x65,
+      0x79, 0x18, 0x01, 0x20, 0x01, 0x28, 0x09, 0x52, 0x03, 0x6B, 0x65, 0x79, 0x12, 0x14, 0x0A, 0x05,
+      0x76, 0x61, 0x6C, 0x75, 0x65, 0x18, 0x02, 0x20, 0x01, 0x28, 0x03, 0x52, 0x05, 0x76, 0x61, 0x6C,
+      0x75, 0x65, 0x3A, 0x02, 0x38, 0x01, 0x3A, 0x04, 0xA0, 0xBB, 0x18, 0x01, 0x2A, 0x2E, 0x0A, 0x0A,
+      0x53, 0x65, 0x74, 0x74, 0x6C, 0x65, 0x4B, 0x69, 0x6E, 0x64, 0x12, 0x0F, 0x0A, 0x0B, 0x53, 0x45,
+      0x54, 0x54, 0x4C, 0x45, 0x5F, 0x4E, 0x4F, 0x4E, 0x45, 0x10, 0x00, 0x12, 0x0F, 0x0A, 0x0B, 0x53,
+      0x45, 0x54, 0x54, 0x4C, 0x45, 0x5F, 0x46, 0x55, 0x4C, 0x4C, 0x10, 0x01, 0x32, 0xBD, 0x02, 0x0A,
+      0x0D, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x12, 0x5C,
+      0x0A, 0x08, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x12, 0x14, 0x2E, 0x74, 0x6F, 0x6B,
+      0x65, 0x6E, 0x2E, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x49, 0x6E, 0x70, 0x75, 0x74,
+      0x1A, 0x16, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x62,
+      0x75, 0x66, 0x2E, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x22, 0x22, 0x90, 0x89, 0xF7, 0x01, 0xE8, 0x07,
+      0x9A, 0x89, 0xF7, 0x01, 0x06, 0x52, 0x45, 0x41, 0x44, 0x3D, 0x32, 0x9A, 0x89, 0xF7, 0x01, 0x07,
+      0x57, 0x52, 0x49, 0x54, 0x45, 0x3D, 0x35, 0xA0, 0x89, 0xF7, 0x01, 0x01, 0x12, 0x41, 0x0A, 0x0D,
+      0x42, 0x61, 0x74, 0x63, 0x68, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x12, 0x14, 0x2E,
+      0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72, 0x49, 0x6E,
+      0x70, 0x75, 0x74, 0x1A, 0x16, 0x2E, 0x67, 0x6F, 0x6F, 0x67, 0x6C, 0x65, 0x2E, 0x70, 0x72, 0x6F,
+      0x74, 0x6F, 0x62, 0x75, 0x66, 0x2E, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x22, 0x00, 0x28, 0x01, 0x12,
+      0x49, 0x0A, 0x0A, 0x47, 0x65, 0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x12, 0x16, 0x2E,
+      0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x47, 0x65, 0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65,
+      0x49, 0x6E, 0x70, 0x75, 0x74, 0x1A, 0x17, 0x2E, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x47, 0x65,
+      0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65, 0x4F, 0x75, 0x74, 0x70, 0x75, 0x74, 0x22, 0x0A,
+      0x88, 0x89, 0xF7, 0x01, 0x01, 0x90, 0x89, 0xF7, 0x01, 0x00, 0x1A, 0x40, 0xCA, 0xCA, 0xF6, 0x01,
+      0x0A, 0x61, 0x63, 0x73, 0x31, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0xB2, 0xCC, 0xF6, 0x01, 0x2C,
+      0x41, 0x45, 0x6C, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x73, 0x2E, 0x4D,
+      0x75, 0x6C, 0x74, 0x69, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x2E, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x43,
+      0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x53, 0x74, 0x61, 0x74, 0x65, 0x42, 0x1C, 0xAA, 0x02,
+      0x19, 0x41, 0x45, 0x6C, 0x66, 0x2E, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x61, 0x63, 0x74, 0x73, 0x2E,
+      0x4D, 0x75, 0x6C, 0x74, 0x69, 0x54, 0x6F, 0x6B, 0x65, 0x6E, 0x62, 0x06, 0x70, 0x72, 0x6F, 0x74,
+      0x6F, 0x33,
+    };
+
+    static readonly global::System.Lazy<global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor>> __FileDescriptors =
+        new global::System.Lazy<global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor>>(BuildFileDescriptors);
+
+    static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.FileDescriptor> BuildFileDescriptors()
+    {
+      var input = new global::Google.Protobuf.CodedInputStream(__DescriptorData.ToArray());
+      var data = new global::System.Collections.Generic.List<global::Google.Protobuf.ByteString>();
+      while (input.ReadTag() != 0)
+      {
+        data.Add(input.ReadBytes());
+      }
+      return global::Google.Protobuf.Reflection.FileDescriptor.BuildFromByteStrings(data);
+    }
+
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return __FileDescriptors.Value[5].Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          __FileDescriptors.Value[4].Services[0],
+          __FileDescriptors.Value[5].Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of TokenContract</summary>
+    public abstract partial class TokenContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.MultiToken.TokenContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(TokenContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance).Build();
+    }
+
+  }
+}
+#endregion
+
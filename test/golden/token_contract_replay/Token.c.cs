@@ -0,0 +1,348 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    /// <summary>Base class for the contract of TokenContract</summary>
+    public abstract partial class TokenContractBase : AElf.Sdk.CSharp.CSharpSmartContract<AElf.Contracts.MultiToken.TokenContractState>
+    {
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty SetMethodFee(global::AElf.Standards.ACS1.MethodFees input);
+      public abstract global::AElf.Standards.ACS1.MethodFees GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty Transfer(global::AElf.Contracts.MultiToken.TransferInput input);
+      public abstract global::Google.Protobuf.WellKnownTypes.Empty BatchTransfer(grpc::IAsyncStreamReader<global::AElf.Contracts.MultiToken.TransferInput> requestStream);
+      public abstract global::AElf.Contracts.MultiToken.GetBalanceOutput GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input);
+    }
+
+    public static aelf::ServerServiceDefinition BindService(TokenContractBase serviceImpl)
+    {
+      return aelf::ServerServiceDefinition.CreateBuilder()
+          .AddDescriptors(Descriptors)
+          .AddMethod(__Method_SetMethodFee, serviceImpl.SetMethodFee)
+          .AddMethod(__Method_GetMethodFee, serviceImpl.GetMethodFee)
+          .AddMethod(__Method_Transfer, serviceImpl.Transfer)
+          .AddMethod(__Method_BatchTransfer, serviceImpl.BatchTransfer)
+          .AddMethod(__Method_GetBalance, serviceImpl.GetBalance).Build();
+    }
+
+    public static class TokenContractReplay
+    {
+      public sealed class MethodReport
+      {
+        internal readonly global::System.Collections.Generic.List<long> __elapsedTicks = new global::System.Collections.Generic.List<long>();
+
+        internal MethodReport(string method)
+        {
+          Method = method;
+        }
+
+        public string Method { get; }
+        public int Calls { get { return __elapsedTicks.Count; } }
+        public int Failures { get; internal set; }
+        public long AllocatedBytes { get; internal set; }
+
+        // Nearest-rank percentile of the call latencies, in microseconds.
+        public double GetLatencyPercentile(double percentile)
+        {
+          if (__elapsedTicks.Count == 0)
+          {
+            return 0;
+          }
+          var rank = (int) global::System.Math.Ceiling(percentile / 100 * __elapsedTicks.Count);
+          var ticks = __elapsedTicks[global::System.Math.Min(__elapsedTicks.Count, global::System.Math.Max(rank, 1)) - 1];
+          return ticks * 1000000.0 / global::System.Diagnostics.Stopwatch.Frequency;
+        }
+      }
+
+      public sealed class Report
+      {
+        internal Report(global::System.Collections.Generic.IReadOnlyList<MethodReport> methods, int skippedRecords)
+        {
+          Methods = methods;
+          SkippedRecords = skippedRecords;
+        }
+
+        public global::System.Collections.Generic.IReadOnlyList<MethodReport> Methods { get; }
+        // Records of unknown or streaming methods.
+        public int SkippedRecords { get; }
+
+        public override string ToString()
+        {
+          var builder = new global::System.Text.StringBuilder();
+          builder.AppendLine("method\tcalls\tfailures\tp50_us\tp90_us\tp99_us\tmax_us\tallocated_bytes_per_call");
+          foreach (var method in Methods)
+          {
+            builder.AppendFormat(global::System.Globalization.CultureInfo.InvariantCulture,
+                "{0}\t{1}\t{2}\t{3:F1}\t{4:F1}\t{5:F1}\t{6:F1}\t{7}",
+                method.Method, method.Calls, method.Failures,
+                method.GetLatencyPercentile(50), method.GetLatencyPercentile(90),
+                method.GetLatencyPercentile(99), method.GetLatencyPercentile(100),
+                method.Calls == 0 ? 0 : method.AllocatedBytes / method.Calls);
+            builder.AppendLine();
+          }
+          builder.AppendLine("skipped\t" + SkippedRecords);
+          return builder.ToString();
+        }
+      }
+
+      public static Report Run(TokenContractBase contract, global::System.IO.Stream trace)
+      {
+        var methods = new MethodReport[4]
+        {
+          new MethodReport("SetMethodFee"),
+          new MethodReport("GetMethodFee"),
+          new MethodReport("Transfer"),
+          new MethodReport("GetBalance"),
+        };
+        var skipped = 0;
+        var records = new global::Google.Protobuf.CodedInputStream(trace, true);
+        while (!records.IsAtEnd)
+        {
+          var record = new global::Google.Protobuf.CodedInputStream(records.ReadBytes().ToByteArray());
+          var name = "";
+          var input = new byte[0];
+          uint tag;
+          while ((tag = record.ReadTag()) != 0)
+          {
+            switch (tag)
+            {
+              case 10:
+                name = record.ReadString();
+                break;
+              case 18:
+                input = record.ReadBytes().ToByteArray();
+                break;
+              default:
+                record.SkipLastField();
+                break;
+            }
+          }
+          var start = global::System.Diagnostics.Stopwatch.GetTimestamp();
+          var startAllocatedBytes = global::System.GC.GetAllocatedBytesForCurrentThread();
+          var method = -1;
+          try
+          {
+            switch (name)
+            {
+              case "SetMethodFee":
+                method = 0;
+                __Method_SetMethodFee.ResponseMarshaller.Serializer(contract.SetMethodFee(__Method_SetMethodFee.RequestMarshaller.Deserializer(input)));
+                break;
+              case "GetMethodFee":
+                method = 1;
+                __Method_GetMethodFee.ResponseMarshaller.Serializer(contract.GetMethodFee(__Method_GetMethodFee.RequestMarshaller.Deserializer(input)));
+                break;
+              case "Transfer":
+                method = 2;
+                __Method_Transfer.ResponseMarshaller.Serializer(contract.Transfer(__Method_Transfer.RequestMarshaller.Deserializer(input)));
+                break;
+              case "GetBalance":
+                method = 3;
+                __Method_GetBalance.ResponseMarshaller.Serializer(contract.GetBalance(__Method_GetBalance.RequestMarshaller.Deserializer(input)));
+                break;
+              default:
+                skipped++;
+                continue;
+            }
+          }
+          catch (global::System.Exception)
+          {
+            methods[method].Failures++;
+            continue;
+          }
+          var elapsed = global::System.Diagnostics.Stopwatch.GetTimestamp() - start;
+          methods[method].AllocatedBytes += global::System.GC.GetAllocatedBytesForCurrentThread() - startAllocatedBytes;
+          methods[method].__elapsedTicks.Add(elapsed);
+        }
+        foreach (var method in methods)
+        {
+          method.__elapsedTicks.Sort();
+        }
+        return new Report(methods, skipped);
+      }
+    }
+
+  }
+}
+#endregion
+
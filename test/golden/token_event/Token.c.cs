@@ -0,0 +1,786 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  internal static class TokenEventWire
+  {
+    internal static bool TryReadVarint(global::System.ReadOnlySpan<byte> data, ref int offset, out ulong value)
+    {
+      value = 0;
+      for (var shift = 0; shift < 64 && offset < data.Length; shift += 7)
+      {
+        var b = data[offset++];
+        value |= (ulong) (b & 0x7F) << shift;
+        if (b < 0x80)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    internal static bool TryReadField(global::System.ReadOnlySpan<byte> data, ref int offset, out uint tag, out global::System.ReadOnlySpan<byte> value)
+    {
+      tag = 0;
+      value = default(global::System.ReadOnlySpan<byte>);
+      if (!TryReadVarint(data, ref offset, out var rawTag) || rawTag > uint.MaxValue)
+      {
+        return false;
+      }
+      tag = (uint) rawTag;
+      var start = offset;
+      ulong length;
+      switch (tag & 7)
+      {
+        case 0:
+          if (!TryReadVarint(data, ref offset, out length))
+          {
+            return false;
+          }
+          value = data.Slice(start, offset - start);
+          return true;
+        case 1:
+          length = 8;
+          break;
+        case 2:
+          if (!TryReadVarint(data, ref offset, out length))
+          {
+            return false;
+          }
+          break;
+        case 5:
+          length = 4;
+          break;
+        default:
+          return false;
+      }
+      if (length > (ulong) (data.Length - offset))
+      {
+        return false;
+      }
+      value = data.Slice(offset, (int) length);
+      offset += (int) length;
+      return true;
+    }
+
+    internal static ulong ReadVarint(global::System.ReadOnlySpan<byte> value)
+    {
+      var offset = 0;
+      TryReadVarint(value, ref offset, out var result);
+      return result;
+    }
+
+    internal static uint ReadFixed32(global::System.ReadOnlySpan<byte> value)
+    {
+      return value.Length < 4 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt32LittleEndian(value);
+    }
+
+    internal static ulong ReadFixed64(global::System.ReadOnlySpan<byte> value)
+    {
+      return value.Length < 8 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt64LittleEndian(value);
+    }
+
+    internal static int DecodeZigZag32(uint value)
+    {
+      return (int) (value >> 1) ^ -(int) (value & 1);
+    }
+
+    internal static long DecodeZigZag64(ulong value)
+    {
+      return (long) (value >> 1) ^ -(long) (value & 1);
+    }
+  }
+
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Transferred" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Transferred { From = From });
+      bloom.AddValue(new Transferred { To = To });
+      bloom.AddValue(new Transferred { Symbol = Symbol });
+      return bloom;
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __From;
+      global::System.ReadOnlySpan<byte> __To;
+      global::System.ReadOnlySpan<byte> __Symbol;
+      global::System.ReadOnlySpan<byte> __Amount;
+      global::System.ReadOnlySpan<byte> __Memo;
+      global::System.ReadOnlySpan<byte> __Snapshot;
+
+      public string From { get { return global::System.Text.Encoding.UTF8.GetString(__From); } }
+      public global::System.ReadOnlySpan<byte> FromUtf8 { get { return __From; } }
+      public string To { get { return global::System.Text.Encoding.UTF8.GetString(__To); } }
+      public global::System.ReadOnlySpan<byte> ToUtf8 { get { return __To; } }
+      public string Symbol { get { return global::System.Text.Encoding.UTF8.GetString(__Symbol); } }
+      public global::System.ReadOnlySpan<byte> SymbolUtf8 { get { return __Symbol; } }
+      public long Amount { get { return (long) TokenEventWire.ReadVarint(__Amount); } }
+      public string Memo { get { return global::System.Text.Encoding.UTF8.GetString(__Memo); } }
+      public global::System.ReadOnlySpan<byte> MemoUtf8 { get { return __Memo; } }
+      public global::System.ReadOnlySpan<byte> Snapshot { get { return __Snapshot; } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 10:
+              __From = value;
+              break;
+            case 18:
+              __To = value;
+              break;
+            case 26:
+              __Symbol = value;
+              break;
+            case 32:
+              __Amount = value;
+              break;
+            case 42:
+              __Memo = value;
+              break;
+            case 58:
+              __Snapshot = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Transferred> events, int[] sizes, Transferred[] messages)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var part = i * 4;
+        foreach (var indexed in e.GetIndexed())
+        {
+          messages[part++] = indexed;
+        }
+        messages[part] = e.GetNonIndexed();
+        for (var j = i * 4; j <= part; j++)
+        {
+          sizes[j] = messages[j].CalculateSize();
+          total += sizes[j];
+        }
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address, int[] sizes, Transferred[] messages, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Transferred";
+        logEvent.Indexed.Clear();
+        messages[i * 4 + 0].WriteTo(output);
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 0]));
+        offset += sizes[i * 4 + 0];
+        logEvent.Indexed.Add(part0);
+        messages[i * 4 + 1].WriteTo(output);
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 1]));
+        offset += sizes[i * 4 + 1];
+        logEvent.Indexed.Add(part1);
+        messages[i * 4 + 2].WriteTo(output);
+        var part2 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 2]));
+        offset += sizes[i * 4 + 2];
+        logEvent.Indexed.Add(part2);
+        messages[i * 4 + 3].WriteTo(output);
+        var part3 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 3]));
+        offset += sizes[i * 4 + 3];
+        logEvent.NonIndexed = part3;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 4];
+      var messages = new Transferred[events.Count * 4];
+      var total = __ComputeSizes(events, sizes, messages);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, messages, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      Transferred[] __messages = new Transferred[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 4];
+          __messages = new Transferred[events.Count * 4];
+        }
+        var total = __ComputeSizes(events, __sizes, __messages);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, __messages, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Burned" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Burned { Burner = Burner });
+      return bloom;
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __Burner;
+      global::System.ReadOnlySpan<byte> __Amount;
+
+      public string Burner { get { return global::System.Text.Encoding.UTF8.GetString(__Burner); } }
+      public global::System.ReadOnlySpan<byte> BurnerUtf8 { get { return __Burner; } }
+      public long Amount { get { return (long) TokenEventWire.ReadVarint(__Amount); } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 10:
+              __Burner = value;
+              break;
+            case 16:
+              __Amount = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Burned> events, int[] sizes)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        int size;
+        size = 0;
+        if (e.Burner.Length != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeStringSize(e.Burner);
+        }
+        sizes[i * 2 + 0] = size;
+        total += size;
+        size = 0;
+        if (e.Amount != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeInt64Size(e.Amount);
+        }
+        sizes[i * 2 + 1] = size;
+        total += size;
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address, int[] sizes, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Burned";
+        logEvent.Indexed.Clear();
+        if (e.Burner.Length != 0)
+        {
+          output.WriteTag(10);
+          output.WriteString(e.Burner);
+        }
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 0]));
+        offset += sizes[i * 2 + 0];
+        logEvent.Indexed.Add(part0);
+        if (e.Amount != 0)
+        {
+          output.WriteTag(16);
+          output.WriteInt64(e.Amount);
+        }
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 1]));
+        offset += sizes[i * 2 + 1];
+        logEvent.NonIndexed = part1;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 2];
+      var total = __ComputeSizes(events, sizes);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 2];
+        }
+        var total = __ComputeSizes(events, __sizes);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Settled" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Settled { Delta = Delta });
+      bloom.AddValue(new Settled { Offset = Offset });
+      return bloom;
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __Round;
+      global::System.ReadOnlySpan<byte> __Delta;
+      global::System.ReadOnlySpan<byte> __Final;
+      global::System.ReadOnlySpan<byte> __Checksum;
+      global::System.ReadOnlySpan<byte> __Ratio;
+      global::System.ReadOnlySpan<byte> __Payload;
+      global::System.ReadOnlySpan<byte> __Weight;
+      global::System.ReadOnlySpan<byte> __Offset;
+      global::System.ReadOnlySpan<byte> __Kind;
+      global::System.ReadOnlySpan<byte> __Shift;
+
+      public uint Round { get { return (uint) TokenEventWire.ReadVarint(__Round); } }
+      public long Delta { get { return TokenEventWire.DecodeZigZag64(TokenEventWire.ReadVarint(__Delta)); } }
+      public bool Final { get { return TokenEventWire.ReadVarint(__Final) != 0; } }
+      public uint Checksum { get { return TokenEventWire.ReadFixed32(__Checksum); } }
+      public double Ratio { get { return global::System.BitConverter.Int64BitsToDouble((long) TokenEventWire.ReadFixed64(__Ratio)); } }
+      public global::System.ReadOnlySpan<byte> Payload { get { return __Payload; } }
+      public float Weight { get { return global::System.BitConverter.Int32BitsToSingle((int) TokenEventWire.ReadFixed32(__Weight)); } }
+      public long Offset { get { return (long) TokenEventWire.ReadFixed64(__Offset); } }
+      public global::AElf.Contracts.MultiToken.SettleKind Kind { get { return (global::AElf.Contracts.MultiToken.SettleKind) (int) TokenEventWire.ReadVarint(__Kind); } }
+      public int Shift { get { return TokenEventWire.DecodeZigZag32((uint) TokenEventWire.ReadVarint(__Shift)); } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 8:
+              __Round = value;
+              break;
+            case 16:
+              __Delta = value;
+              break;
+            case 24:
+              __Final = value;
+              break;
+            case 37:
+              __Checksum = value;
+              break;
+            case 41:
+              __Ratio = value;
+              break;
+            case 50:
+              __Payload = value;
+              break;
+            case 61:
+              __Weight = value;
+              break;
+            case 65:
+              __Offset = value;
+              break;
+            case 72:
+              __Kind = value;
+              break;
+            case 88:
+              __Shift = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Settled> events, int[] sizes, Settled[] messages)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var part = i * 3;
+        foreach (var indexed in e.GetIndexed())
+        {
+          messages[part++] = indexed;
+        }
+        messages[part] = e.GetNonIndexed();
+        for (var j = i * 3; j <= part; j++)
+        {
+          sizes[j] = messages[j].CalculateSize();
+          total += sizes[j];
+        }
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address, int[] sizes, Settled[] messages, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Settled";
+        logEvent.Indexed.Clear();
+        messages[i * 3 + 0].WriteTo(output);
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 0]));
+        offset += sizes[i * 3 + 0];
+        logEvent.Indexed.Add(part0);
+        messages[i * 3 + 1].WriteTo(output);
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 1]));
+        offset += sizes[i * 3 + 1];
+        logEvent.Indexed.Add(part1);
+        messages[i * 3 + 2].WriteTo(output);
+        var part2 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 2]));
+        offset += sizes[i * 3 + 2];
+        logEvent.NonIndexed = part2;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 3];
+      var messages = new Settled[events.Count * 3];
+      var total = __ComputeSizes(events, sizes, messages);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, messages, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      Settled[] __messages = new Settled[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 3];
+          __messages = new Settled[events.Count * 3];
+        }
+        var total = __ComputeSizes(events, __sizes, __messages);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, __messages, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public static class TokenEventRouter
+  {
+    public interface IHandler
+    {
+      void OnTransferred(Transferred eventData, global::AElf.Types.LogEvent logEvent);
+      void OnBurned(Burned eventData, global::AElf.Types.LogEvent logEvent);
+      void OnSettled(Settled eventData, global::AElf.Types.LogEvent logEvent);
+    }
+
+    public abstract class HandlerBase : IHandler
+    {
+      public virtual void OnTransferred(Transferred eventData, global::AElf.Types.LogEvent logEvent) {}
+      public virtual void OnBurned(Burned eventData, global::AElf.Types.LogEvent logEvent) {}
+      public virtual void OnSettled(Settled eventData, global::AElf.Types.LogEvent logEvent) {}
+    }
+
+    public static bool Route<THandler>(global::AElf.Types.LogEvent logEvent, ref THandler handler)
+        where THandler : IHandler
+    {
+      switch (logEvent.Name)
+      {
+        case "Transferred":
+        {
+          var eventData = new Transferred();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnTransferred(eventData, logEvent);
+          return true;
+        }
+        case "Burned":
+        {
+          var eventData = new Burned();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnBurned(eventData, logEvent);
+          return true;
+        }
+        case "Settled":
+        {
+          var eventData = new Settled();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnSettled(eventData, logEvent);
+          return true;
+        }
+        default:
+          return false;
+      }
+    }
+  }
+
+  #endregion
+}
+#endregion
+
@@ -0,0 +1,374 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Transferred> events, int[] sizes, Transferred[] messages)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var part = i * 4;
+        foreach (var indexed in e.GetIndexed())
+        {
+          messages[part++] = indexed;
+        }
+        messages[part] = e.GetNonIndexed();
+        for (var j = i * 4; j <= part; j++)
+        {
+          sizes[j] = messages[j].CalculateSize();
+          total += sizes[j];
+        }
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address, int[] sizes, Transferred[] messages, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Transferred";
+        logEvent.Indexed.Clear();
+        messages[i * 4 + 0].WriteTo(output);
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 0]));
+        offset += sizes[i * 4 + 0];
+        logEvent.Indexed.Add(part0);
+        messages[i * 4 + 1].WriteTo(output);
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 1]));
+        offset += sizes[i * 4 + 1];
+        logEvent.Indexed.Add(part1);
+        messages[i * 4 + 2].WriteTo(output);
+        var part2 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 2]));
+        offset += sizes[i * 4 + 2];
+        logEvent.Indexed.Add(part2);
+        messages[i * 4 + 3].WriteTo(output);
+        var part3 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 4 + 3]));
+        offset += sizes[i * 4 + 3];
+        logEvent.NonIndexed = part3;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 4];
+      var messages = new Transferred[events.Count * 4];
+      var total = __ComputeSizes(events, sizes, messages);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, messages, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      Transferred[] __messages = new Transferred[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Transferred> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 4];
+          __messages = new Transferred[events.Count * 4];
+        }
+        var total = __ComputeSizes(events, __sizes, __messages);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, __messages, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Burned> events, int[] sizes)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        int size;
+        size = 0;
+        if (e.Burner.Length != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeStringSize(e.Burner);
+        }
+        sizes[i * 2 + 0] = size;
+        total += size;
+        size = 0;
+        if (e.Amount != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeInt64Size(e.Amount);
+        }
+        sizes[i * 2 + 1] = size;
+        total += size;
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address, int[] sizes, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Burned";
+        logEvent.Indexed.Clear();
+        if (e.Burner.Length != 0)
+        {
+          output.WriteTag(10);
+          output.WriteString(e.Burner);
+        }
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 0]));
+        offset += sizes[i * 2 + 0];
+        logEvent.Indexed.Add(part0);
+        if (e.Amount != 0)
+        {
+          output.WriteTag(16);
+          output.WriteInt64(e.Amount);
+        }
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 2 + 1]));
+        offset += sizes[i * 2 + 1];
+        logEvent.NonIndexed = part1;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 2];
+      var total = __ComputeSizes(events, sizes);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Burned> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 2];
+        }
+        var total = __ComputeSizes(events, __sizes);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+
+    static int __ComputeSizes(global::System.Collections.Generic.IReadOnlyList<Settled> events, int[] sizes, Settled[] messages)
+    {
+      var total = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var e = events[i];
+        var part = i * 3;
+        foreach (var indexed in e.GetIndexed())
+        {
+          messages[part++] = indexed;
+        }
+        messages[part] = e.GetNonIndexed();
+        for (var j = i * 3; j <= part; j++)
+        {
+          sizes[j] = messages[j].CalculateSize();
+          total += sizes[j];
+        }
+      }
+      return total;
+    }
+
+    static void __WriteLogEvents(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address, int[] sizes, Settled[] messages, int total, byte[] buffer, global::AElf.Types.LogEvent[] logEvents)
+    {
+      var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+      var offset = 0;
+      for (var i = 0; i < events.Count; i++)
+      {
+        var logEvent = logEvents[i] ?? (logEvents[i] = new global::AElf.Types.LogEvent());
+        logEvent.Address = address;
+        logEvent.Name = "Settled";
+        logEvent.Indexed.Clear();
+        messages[i * 3 + 0].WriteTo(output);
+        var part0 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 0]));
+        offset += sizes[i * 3 + 0];
+        logEvent.Indexed.Add(part0);
+        messages[i * 3 + 1].WriteTo(output);
+        var part1 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 1]));
+        offset += sizes[i * 3 + 1];
+        logEvent.Indexed.Add(part1);
+        messages[i * 3 + 2].WriteTo(output);
+        var part2 = global::Google.Protobuf.UnsafeByteOperations.UnsafeWrap(new global::System.ReadOnlyMemory<byte>(buffer, offset, sizes[i * 3 + 2]));
+        offset += sizes[i * 3 + 2];
+        logEvent.NonIndexed = part2;
+      }
+      if (output.Position != total)
+      {
+        throw new global::System.InvalidOperationException("Log events written with a size different from the computed one.");
+      }
+    }
+
+    public static global::AElf.Types.LogEvent[] ToLogEvents(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address)
+    {
+      var sizes = new int[events.Count * 3];
+      var messages = new Settled[events.Count * 3];
+      var total = __ComputeSizes(events, sizes, messages);
+      var logEvents = new global::AElf.Types.LogEvent[events.Count];
+      __WriteLogEvents(events, address, sizes, messages, total, new byte[total], logEvents);
+      return logEvents;
+    }
+
+    public sealed class LogEventBatch
+    {
+      int[] __sizes = new int[0];
+      Settled[] __messages = new Settled[0];
+      byte[] __buffer = new byte[0];
+      global::AElf.Types.LogEvent[] __logEvents = new global::AElf.Types.LogEvent[0];
+
+      public void Fire(global::System.Collections.Generic.IReadOnlyList<Settled> events, global::AElf.Types.Address address,
+          global::System.Action<global::System.ArraySegment<global::AElf.Types.LogEvent>> sink)
+      {
+        if (__logEvents.Length < events.Count)
+        {
+          global::System.Array.Resize(ref __logEvents, events.Count);
+          __sizes = new int[events.Count * 3];
+          __messages = new Settled[events.Count * 3];
+        }
+        var total = __ComputeSizes(events, __sizes, __messages);
+        if (__buffer.Length < total)
+        {
+          __buffer = new byte[total];
+        }
+        __WriteLogEvents(events, address, __sizes, __messages, total, __buffer, __logEvents);
+        sink(new global::System.ArraySegment<global::AElf.Types.LogEvent>(__logEvents, 0, events.Count));
+      }
+    }
+  }
+
+  #endregion
+}
+#endregion
+
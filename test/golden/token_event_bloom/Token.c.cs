@@ -0,0 +1,160 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Transferred" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Transferred { From = From });
+      bloom.AddValue(new Transferred { To = To });
+      bloom.AddValue(new Transferred { Symbol = Symbol });
+      return bloom;
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Burned" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Burned { Burner = Burner });
+      return bloom;
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+
+    static readonly global::AElf.Types.Bloom __NameBloom = __CreateNameBloom();
+
+    static global::AElf.Types.Bloom __CreateNameBloom()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.AddValue(new global::Google.Protobuf.WellKnownTypes.StringValue { Value = "Settled" });
+      return bloom;
+    }
+
+    public global::AElf.Types.Bloom GetBloomBits()
+    {
+      var bloom = new global::AElf.Types.Bloom();
+      bloom.Combine(__NameBloom);
+      bloom.AddValue(new Settled { Delta = Delta });
+      bloom.AddValue(new Settled { Offset = Offset });
+      return bloom;
+    }
+  }
+
+  #endregion
+}
+#endregion
+
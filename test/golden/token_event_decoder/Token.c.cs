@@ -0,0 +1,404 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  internal static class TokenEventWire
+  {
+    internal static bool TryReadVarint(global::System.ReadOnlySpan<byte> data, ref int offset, out ulong value)
+    {
+      value = 0;
+      for (var shift = 0; shift < 64 && offset < data.Length; shift += 7)
+      {
+        var b = data[offset++];
+        value |= (ulong) (b & 0x7F) << shift;
+        if (b < 0x80)
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+    internal static bool TryReadField(global::System.ReadOnlySpan<byte> data, ref int offset, out uint tag, out global::System.ReadOnlySpan<byte> value)
+    {
+      tag = 0;
+      value = default(global::System.ReadOnlySpan<byte>);
+      if (!TryReadVarint(data, ref offset, out var rawTag) || rawTag > uint.MaxValue)
+      {
+        return false;
+      }
+      tag = (uint) rawTag;
+      var start = offset;
+      ulong length;
+      switch (tag & 7)
+      {
+        case 0:
+          if (!TryReadVarint(data, ref offset, out length))
+          {
+            return false;
+          }
+          value = data.Slice(start, offset - start);
+          return true;
+        case 1:
+          length = 8;
+          break;
+        case 2:
+          if (!TryReadVarint(data, ref offset, out length))
+          {
+            return false;
+          }
+          break;
+        case 5:
+          length = 4;
+          break;
+        default:
+          return false;
+      }
+      if (length > (ulong) (data.Length - offset))
+      {
+        return false;
+      }
+      value = data.Slice(offset, (int) length);
+      offset += (int) length;
+      return true;
+    }
+
+    internal static ulong ReadVarint(global::System.ReadOnlySpan<byte> value)
+    {
+      var offset = 0;
+      TryReadVarint(value, ref offset, out var result);
+      return result;
+    }
+
+    internal static uint ReadFixed32(global::System.ReadOnlySpan<byte> value)
+    {
+      return value.Length < 4 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt32LittleEndian(value);
+    }
+
+    internal static ulong ReadFixed64(global::System.ReadOnlySpan<byte> value)
+    {
+      return value.Length < 8 ? 0 : global::System.Buffers.Binary.BinaryPrimitives.ReadUInt64LittleEndian(value);
+    }
+
+    internal static int DecodeZigZag32(uint value)
+    {
+      return (int) (value >> 1) ^ -(int) (value & 1);
+    }
+
+    internal static long DecodeZigZag64(ulong value)
+    {
+      return (long) (value >> 1) ^ -(long) (value & 1);
+    }
+  }
+
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __From;
+      global::System.ReadOnlySpan<byte> __To;
+      global::System.ReadOnlySpan<byte> __Symbol;
+      global::System.ReadOnlySpan<byte> __Amount;
+      global::System.ReadOnlySpan<byte> __Memo;
+      global::System.ReadOnlySpan<byte> __Snapshot;
+
+      public string From { get { return global::System.Text.Encoding.UTF8.GetString(__From); } }
+      public global::System.ReadOnlySpan<byte> FromUtf8 { get { return __From; } }
+      public string To { get { return global::System.Text.Encoding.UTF8.GetString(__To); } }
+      public global::System.ReadOnlySpan<byte> ToUtf8 { get { return __To; } }
+      public string Symbol { get { return global::System.Text.Encoding.UTF8.GetString(__Symbol); } }
+      public global::System.ReadOnlySpan<byte> SymbolUtf8 { get { return __Symbol; } }
+      public long Amount { get { return (long) TokenEventWire.ReadVarint(__Amount); } }
+      public string Memo { get { return global::System.Text.Encoding.UTF8.GetString(__Memo); } }
+      public global::System.ReadOnlySpan<byte> MemoUtf8 { get { return __Memo; } }
+      public global::System.ReadOnlySpan<byte> Snapshot { get { return __Snapshot; } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 10:
+              __From = value;
+              break;
+            case 18:
+              __To = value;
+              break;
+            case 26:
+              __Symbol = value;
+              break;
+            case 32:
+              __Amount = value;
+              break;
+            case 42:
+              __Memo = value;
+              break;
+            case 58:
+              __Snapshot = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __Burner;
+      global::System.ReadOnlySpan<byte> __Amount;
+
+      public string Burner { get { return global::System.Text.Encoding.UTF8.GetString(__Burner); } }
+      public global::System.ReadOnlySpan<byte> BurnerUtf8 { get { return __Burner; } }
+      public long Amount { get { return (long) TokenEventWire.ReadVarint(__Amount); } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 10:
+              __Burner = value;
+              break;
+            case 16:
+              __Amount = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+
+    public static bool TryDecode(global::System.ReadOnlySpan<byte> nonIndexed, global::System.Collections.Generic.IReadOnlyList<global::System.ReadOnlyMemory<byte>> indexed, out WireView view)
+    {
+      view = new WireView();
+      if (!view.TryMerge(nonIndexed))
+      {
+        return false;
+      }
+      for (var i = 0; i < indexed.Count; i++)
+      {
+        if (!view.TryMerge(indexed[i].Span))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    public ref struct WireView
+    {
+      global::System.ReadOnlySpan<byte> __Round;
+      global::System.ReadOnlySpan<byte> __Delta;
+      global::System.ReadOnlySpan<byte> __Final;
+      global::System.ReadOnlySpan<byte> __Checksum;
+      global::System.ReadOnlySpan<byte> __Ratio;
+      global::System.ReadOnlySpan<byte> __Payload;
+      global::System.ReadOnlySpan<byte> __Weight;
+      global::System.ReadOnlySpan<byte> __Offset;
+      global::System.ReadOnlySpan<byte> __Kind;
+      global::System.ReadOnlySpan<byte> __Shift;
+
+      public uint Round { get { return (uint) TokenEventWire.ReadVarint(__Round); } }
+      public long Delta { get { return TokenEventWire.DecodeZigZag64(TokenEventWire.ReadVarint(__Delta)); } }
+      public bool Final { get { return TokenEventWire.ReadVarint(__Final) != 0; } }
+      public uint Checksum { get { return TokenEventWire.ReadFixed32(__Checksum); } }
+      public double Ratio { get { return global::System.BitConverter.Int64BitsToDouble((long) TokenEventWire.ReadFixed64(__Ratio)); } }
+      public global::System.ReadOnlySpan<byte> Payload { get { return __Payload; } }
+      public float Weight { get { return global::System.BitConverter.Int32BitsToSingle((int) TokenEventWire.ReadFixed32(__Weight)); } }
+      public long Offset { get { return (long) TokenEventWire.ReadFixed64(__Offset); } }
+      public global::AElf.Contracts.MultiToken.SettleKind Kind { get { return (global::AElf.Contracts.MultiToken.SettleKind) (int) TokenEventWire.ReadVarint(__Kind); } }
+      public int Shift { get { return TokenEventWire.DecodeZigZag32((uint) TokenEventWire.ReadVarint(__Shift)); } }
+
+      internal bool TryMerge(global::System.ReadOnlySpan<byte> data)
+      {
+        var offset = 0;
+        while (offset < data.Length)
+        {
+          if (!TokenEventWire.TryReadField(data, ref offset, out var tag, out var value))
+          {
+            return false;
+          }
+          switch (tag)
+          {
+            case 8:
+              __Round = value;
+              break;
+            case 16:
+              __Delta = value;
+              break;
+            case 24:
+              __Final = value;
+              break;
+            case 37:
+              __Checksum = value;
+              break;
+            case 41:
+              __Ratio = value;
+              break;
+            case 50:
+              __Payload = value;
+              break;
+            case 61:
+              __Weight = value;
+              break;
+            case 65:
+              __Offset = value;
+              break;
+            case 72:
+              __Kind = value;
+              break;
+            case 88:
+              __Shift = value;
+              break;
+          }
+        }
+        return true;
+      }
+    }
+  }
+
+  #endregion
+}
+#endregion
+
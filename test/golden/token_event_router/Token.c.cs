@@ -0,0 +1,166 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  public static class TokenEventRouter
+  {
+    public interface IHandler
+    {
+      void OnTransferred(Transferred eventData, global::AElf.Types.LogEvent logEvent);
+      void OnBurned(Burned eventData, global::AElf.Types.LogEvent logEvent);
+      void OnSettled(Settled eventData, global::AElf.Types.LogEvent logEvent);
+    }
+
+    public abstract class HandlerBase : IHandler
+    {
+      public virtual void OnTransferred(Transferred eventData, global::AElf.Types.LogEvent logEvent) {}
+      public virtual void OnBurned(Burned eventData, global::AElf.Types.LogEvent logEvent) {}
+      public virtual void OnSettled(Settled eventData, global::AElf.Types.LogEvent logEvent) {}
+    }
+
+    public static bool Route<THandler>(global::AElf.Types.LogEvent logEvent, ref THandler handler)
+        where THandler : IHandler
+    {
+      switch (logEvent.Name)
+      {
+        case "Transferred":
+        {
+          var eventData = new Transferred();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnTransferred(eventData, logEvent);
+          return true;
+        }
+        case "Burned":
+        {
+          var eventData = new Burned();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnBurned(eventData, logEvent);
+          return true;
+        }
+        case "Settled":
+        {
+          var eventData = new Settled();
+          foreach (var indexed in logEvent.Indexed)
+          {
+            global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, indexed);
+          }
+          global::Google.Protobuf.MessageExtensions.MergeFrom(eventData, logEvent.NonIndexed);
+          handler.OnSettled(eventData, logEvent);
+          return true;
+        }
+        default:
+          return false;
+      }
+    }
+  }
+
+  #endregion
+}
+#endregion
+
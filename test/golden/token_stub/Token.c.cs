@@ -0,0 +1,526 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    public sealed class TransactionTemplate<TInput>
+        where TInput : global::Google.Protobuf.IMessage<TInput>
+    {
+      static readonly byte[] __SignatureTag = new byte[] { 0x82, 0xF1, 0x04 };
+      readonly byte[] __prefix;
+
+      internal TransactionTemplate(byte[] header, byte[] methodNameField)
+      {
+        __prefix = new byte[header.Length + methodNameField.Length];
+        global::System.Buffer.BlockCopy(header, 0, __prefix, 0, header.Length);
+        global::System.Buffer.BlockCopy(methodNameField, 0, __prefix, header.Length, methodNameField.Length);
+      }
+
+      public byte[] Encode(TInput input, global::Google.Protobuf.ByteString signature = null)
+      {
+        var paramsSize = input.CalculateSize();
+        var size = __prefix.Length;
+        if (paramsSize != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(paramsSize) + paramsSize;
+        }
+        if (signature != null && !signature.IsEmpty)
+        {
+          size += __SignatureTag.Length + global::Google.Protobuf.CodedOutputStream.ComputeBytesSize(signature);
+        }
+        var buffer = new byte[size];
+        global::System.Buffer.BlockCopy(__prefix, 0, buffer, 0, __prefix.Length);
+        var offset = __prefix.Length;
+        if (paramsSize != 0)
+        {
+          buffer[offset++] = 0x32;
+          WriteLength(buffer, ref offset, paramsSize);
+          global::Google.Protobuf.MessageExtensions.WriteTo(input, new global::System.Span<byte>(buffer, offset, paramsSize));
+          offset += paramsSize;
+        }
+        if (signature != null && !signature.IsEmpty)
+        {
+          global::System.Buffer.BlockCopy(__SignatureTag, 0, buffer, offset, __SignatureTag.Length);
+          offset += __SignatureTag.Length;
+          WriteLength(buffer, ref offset, signature.Length);
+          signature.Span.CopyTo(new global::System.Span<byte>(buffer, offset, signature.Length));
+        }
+        return buffer;
+      }
+
+      static void WriteLength(byte[] buffer, ref int offset, int length)
+      {
+        var value = (uint) length;
+        while (value >= 0x80)
+        {
+          buffer[offset++] = (byte) (value | 0x80);
+          value >>= 7;
+        }
+        buffer[offset++] = (byte) value;
+      }
+    }
+
+    public class TokenContractStub : aelf::ContractStubBase
+    {
+      public TokenContractStubBatch CreateBatch()
+      {
+        return new TokenContractStubBatch();
+      }
+
+      public static byte[] EncodeTransactionHeader(global::AElf.Types.Address from, global::AElf.Types.Address to, long refBlockNumber, global::Google.Protobuf.ByteString refBlockPrefix)
+      {
+        var size = 0;
+        if (from != null)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeMessageSize(from);
+        }
+        if (to != null)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeMessageSize(to);
+        }
+        if (refBlockNumber != 0)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeInt64Size(refBlockNumber);
+        }
+        if (refBlockPrefix != null && !refBlockPrefix.IsEmpty)
+        {
+          size += 1 + global::Google.Protobuf.CodedOutputStream.ComputeBytesSize(refBlockPrefix);
+        }
+        var buffer = new byte[size];
+        var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+        if (from != null)
+        {
+          output.WriteRawTag(10);
+          output.WriteMessage(from);
+        }
+        if (to != null)
+        {
+          output.WriteRawTag(18);
+          output.WriteMessage(to);
+        }
+        if (refBlockNumber != 0)
+        {
+          output.WriteRawTag(24);
+          output.WriteInt64(refBlockNumber);
+        }
+        if (refBlockPrefix != null && !refBlockPrefix.IsEmpty)
+        {
+          output.WriteRawTag(34);
+          output.WriteBytes(refBlockPrefix);
+        }
+        output.CheckNoSpaceLeft();
+        return buffer;
+      }
+
+      aelf::IMethodStub<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __SetMethodFee;
+
+      public aelf::IMethodStub<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> SetMethodFee
+      {
+        get { return __SetMethodFee ?? (__SetMethodFee = __factory.Create(__Method_SetMethodFee)); }
+      }
+
+      /// <summary>Wraps the Task of SetMethodFee.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> SetMethodFeeCallValueTask(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(SetMethodFee.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of SetMethodFee.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> SetMethodFeeSendValueTask(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(SetMethodFee.SendAsync(input));
+      }
+
+      static readonly byte[] __SetMethodFeeMethodNameField = new byte[] { 0x2A, 0x0C, 0x53, 0x65, 0x74, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65 };
+
+      public TransactionTemplate<global::AElf.Standards.ACS1.MethodFees> CreateSetMethodFeeTemplate(byte[] header)
+      {
+        return new TransactionTemplate<global::AElf.Standards.ACS1.MethodFees>(header, __SetMethodFeeMethodNameField);
+      }
+
+      aelf::IMethodStub<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __GetMethodFee;
+
+      public aelf::IMethodStub<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> GetMethodFee
+      {
+        get { return __GetMethodFee ?? (__GetMethodFee = __factory.Create(__Method_GetMethodFee)); }
+      }
+
+      /// <summary>Wraps the Task of GetMethodFee.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::AElf.Standards.ACS1.MethodFees> GetMethodFeeCallValueTask(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::AElf.Standards.ACS1.MethodFees>(GetMethodFee.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of GetMethodFee.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Standards.ACS1.MethodFees>> GetMethodFeeSendValueTask(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Standards.ACS1.MethodFees>>(GetMethodFee.SendAsync(input));
+      }
+
+      static readonly byte[] __GetMethodFeeMethodNameField = new byte[] { 0x2A, 0x0C, 0x47, 0x65, 0x74, 0x4D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x46, 0x65, 0x65 };
+
+      public TransactionTemplate<global::Google.Protobuf.WellKnownTypes.StringValue> CreateGetMethodFeeTemplate(byte[] header)
+      {
+        return new TransactionTemplate<global::Google.Protobuf.WellKnownTypes.StringValue>(header, __GetMethodFeeMethodNameField);
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Transfer;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> Transfer
+      {
+        get { return __Transfer ?? (__Transfer = __factory.Create(__Method_Transfer)); }
+      }
+
+      /// <summary>Wraps the Task of Transfer.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> TransferCallValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(Transfer.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of Transfer.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> TransferSendValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(Transfer.SendAsync(input));
+      }
+
+      static readonly byte[] __TransferMethodNameField = new byte[] { 0x2A, 0x08, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72 };
+
+      public TransactionTemplate<global::AElf.Contracts.MultiToken.TransferInput> CreateTransferTemplate(byte[] header)
+      {
+        return new TransactionTemplate<global::AElf.Contracts.MultiToken.TransferInput>(header, __TransferMethodNameField);
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __BatchTransfer;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> BatchTransfer
+      {
+        get { return __BatchTransfer ?? (__BatchTransfer = __factory.Create(__Method_BatchTransfer)); }
+      }
+
+      /// <summary>Wraps the Task of BatchTransfer.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> BatchTransferCallValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(BatchTransfer.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of BatchTransfer.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> BatchTransferSendValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(BatchTransfer.SendAsync(input));
+      }
+
+      static readonly byte[] __BatchTransferMethodNameField = new byte[] { 0x2A, 0x0D, 0x42, 0x61, 0x74, 0x63, 0x68, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x66, 0x65, 0x72 };
+
+      public TransactionTemplate<global::AElf.Contracts.MultiToken.TransferInput> CreateBatchTransferTemplate(byte[] header)
+      {
+        return new TransactionTemplate<global::AElf.Contracts.MultiToken.TransferInput>(header, __BatchTransferMethodNameField);
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __GetBalance;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> GetBalance
+      {
+        get { return __GetBalance ?? (__GetBalance = __factory.Create(__Method_GetBalance)); }
+      }
+
+      /// <summary>Wraps the Task of GetBalance.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::AElf.Contracts.MultiToken.GetBalanceOutput> GetBalanceCallValueTask(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::AElf.Contracts.MultiToken.GetBalanceOutput>(GetBalance.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of GetBalance.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Contracts.MultiToken.GetBalanceOutput>> GetBalanceSendValueTask(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Contracts.MultiToken.GetBalanceOutput>>(GetBalance.SendAsync(input));
+      }
+
+      static readonly byte[] __GetBalanceMethodNameField = new byte[] { 0x2A, 0x0A, 0x47, 0x65, 0x74, 0x42, 0x61, 0x6C, 0x61, 0x6E, 0x63, 0x65 };
+
+      public TransactionTemplate<global::AElf.Contracts.MultiToken.GetBalanceInput> CreateGetBalanceTemplate(byte[] header)
+      {
+        return new TransactionTemplate<global::AElf.Contracts.MultiToken.GetBalanceInput>(header, __GetBalanceMethodNameField);
+      }
+
+    }
+
+    public sealed class BatchCall<TOutput>
+    {
+      internal BatchCall(int index)
+      {
+        Index = index;
+      }
+
+      public int Index { get; }
+      public TOutput Output { get; internal set; }
+    }
+
+    public class TokenContractStubBatch
+    {
+      readonly global::System.Collections.Generic.List<string> __methodNames = new global::System.Collections.Generic.List<string>();
+      readonly global::System.Collections.Generic.List<global::Google.Protobuf.IMessage> __inputs = new global::System.Collections.Generic.List<global::Google.Protobuf.IMessage>();
+      readonly global::System.Collections.Generic.List<global::System.Action<byte[]>> __outputReaders = new global::System.Collections.Generic.List<global::System.Action<byte[]>>();
+
+      public int Count { get { return __inputs.Count; } }
+
+      public BatchCall<global::Google.Protobuf.WellKnownTypes.Empty> SetMethodFee(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        return __Add(__Method_SetMethodFee, input);
+      }
+
+      public BatchCall<global::AElf.Standards.ACS1.MethodFees> GetMethodFee(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        return __Add(__Method_GetMethodFee, input);
+      }
+
+      public BatchCall<global::Google.Protobuf.WellKnownTypes.Empty> Transfer(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return __Add(__Method_Transfer, input);
+      }
+
+      public BatchCall<global::AElf.Contracts.MultiToken.GetBalanceOutput> GetBalance(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        return __Add(__Method_GetBalance, input);
+      }
+
+      BatchCall<TOutput> __Add<TInput, TOutput>(aelf::Method<TInput, TOutput> method, TInput input)
+          where TInput : global::Google.Protobuf.IMessage
+      {
+        var call = new BatchCall<TOutput>(__inputs.Count);
+        __methodNames.Add(method.Name);
+        __inputs.Add(input);
+        __outputReaders.Add(bytes => call.Output = method.ResponseMarshaller.Deserializer(bytes));
+        return call;
+      }
+
+      public byte[] ToByteArray()
+      {
+        var sizes = new int[__inputs.Count];
+        var size = global::Google.Protobuf.CodedOutputStream.ComputeInt32Size(__inputs.Count);
+        for (var i = 0; i < __inputs.Count; i++)
+        {
+          sizes[i] = __inputs[i].CalculateSize();
+          size += global::Google.Protobuf.CodedOutputStream.ComputeStringSize(__methodNames[i]) +
+                  global::Google.Protobuf.CodedOutputStream.ComputeLengthSize(sizes[i]) + sizes[i];
+        }
+        var buffer = new byte[size];
+        var output = new global::Google.Protobuf.CodedOutputStream(buffer);
+        output.WriteInt32(__inputs.Count);
+        for (var i = 0; i < __inputs.Count; i++)
+        {
+          output.WriteString(__methodNames[i]);
+          output.WriteLength(sizes[i]);
+          __inputs[i].WriteTo(output);
+        }
+        output.CheckNoSpaceLeft();
+        return buffer;
+      }
+
+      public void SetOutputs(byte[] outputs)
+      {
+        var input = new global::Google.Protobuf.CodedInputStream(outputs);
+        var results = new byte[__outputReaders.Count][];
+        for (var i = 0; i < results.Length; i++)
+        {
+          results[i] = input.ReadBytes().ToByteArray();
+        }
+        if (!input.IsAtEnd)
+        {
+          throw new global::System.InvalidOperationException("The batch results hold more than " + results.Length + " outputs.");
+        }
+        for (var i = 0; i < results.Length; i++)
+        {
+          __outputReaders[i](results[i]);
+        }
+      }
+
+      public async global::System.Threading.Tasks.Task ExecuteAsync(global::System.Func<byte[], global::System.Threading.Tasks.Task<byte[]>> send)
+      {
+        SetOutputs(await send(ToByteArray()));
+      }
+    }
+  }
+}
+#endregion
+
@@ -0,0 +1,288 @@
+// <auto-generated>
+//     Generated by the protocol buffer compiler.  DO NOT EDIT!
+//     source: token.proto
+// </auto-generated>
+#pragma warning disable 0414, 1591
+#region Designer generated code
+
+using System.Collections.Generic;
+using aelf = global::AElf.CSharp.Core;
+
+namespace AElf.Contracts.MultiToken {
+
+  #region Events
+  public partial class Transferred : aelf::IEvent<Transferred>
+  {
+    public global::System.Collections.Generic.IEnumerable<Transferred> GetIndexed()
+    {
+      return new List<Transferred>
+      {
+      new Transferred
+      {
+        From = From
+      },
+      new Transferred
+      {
+        To = To
+      },
+      new Transferred
+      {
+        Symbol = Symbol
+      },
+      };
+    }
+
+    public Transferred GetNonIndexed()
+    {
+      return new Transferred
+      {
+        Amount = Amount,
+        Memo = Memo,
+        Tags = Tags,
+        Snapshot = Snapshot,
+      };
+    }
+  }
+
+  public partial class Burned : aelf::IEvent<Burned>
+  {
+    public global::System.Collections.Generic.IEnumerable<Burned> GetIndexed()
+    {
+      return new List<Burned>
+      {
+      new Burned
+      {
+        Burner = Burner
+      },
+      };
+    }
+
+    public Burned GetNonIndexed()
+    {
+      return new Burned
+      {
+        Amount = Amount,
+      };
+    }
+  }
+
+  public partial class Settled : aelf::IEvent<Settled>
+  {
+    public global::System.Collections.Generic.IEnumerable<Settled> GetIndexed()
+    {
+      return new List<Settled>
+      {
+      new Settled
+      {
+        Delta = Delta
+      },
+      new Settled
+      {
+        Offset = Offset
+      },
+      };
+    }
+
+    public Settled GetNonIndexed()
+    {
+      return new Settled
+      {
+        Round = Round,
+        Final = Final,
+        Checksum = Checksum,
+        Ratio = Ratio,
+        Payload = Payload,
+        Weight = Weight,
+        Kind = Kind,
+        Balances = Balances,
+        Shift = Shift,
+      };
+    }
+  }
+
+  #endregion
+  /// <summary>
+  /// Multi token contract.
+  /// </summary>
+  public static partial class TokenContractContainer
+  {
+    static readonly string __ServiceName = "token.TokenContract";
+
+    #region Marshallers
+    static readonly aelf::Marshaller<global::AElf.Standards.ACS1.MethodFees> __Marshaller_acs1_MethodFees = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Standards.ACS1.MethodFees.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.Empty> __Marshaller_google_protobuf_Empty = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.Empty.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::Google.Protobuf.WellKnownTypes.StringValue> __Marshaller_google_protobuf_StringValue = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::Google.Protobuf.WellKnownTypes.StringValue.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.TransferInput> __Marshaller_token_TransferInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.TransferInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceInput> __Marshaller_token_GetBalanceInput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceInput.Parser.ParseFrom);
+    static readonly aelf::Marshaller<global::AElf.Contracts.MultiToken.GetBalanceOutput> __Marshaller_token_GetBalanceOutput = aelf::Marshallers.Create((arg) => global::Google.Protobuf.MessageExtensions.ToByteArray(arg), global::AElf.Contracts.MultiToken.GetBalanceOutput.Parser.ParseFrom);
+    #endregion
+
+    #region Methods
+    static readonly aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __Method_SetMethodFee = new aelf::Method<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "SetMethodFee",
+        __Marshaller_acs1_MethodFees,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __Method_GetMethodFee = new aelf::Method<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetMethodFee",
+        __Marshaller_google_protobuf_StringValue,
+        __Marshaller_acs1_MethodFees);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_Transfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "Transfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Method_BatchTransfer = new aelf::Method<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty>(
+        aelf::MethodType.Action,
+        __ServiceName,
+        "BatchTransfer",
+        __Marshaller_token_TransferInput,
+        __Marshaller_google_protobuf_Empty);
+
+    static readonly aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __Method_GetBalance = new aelf::Method<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput>(
+        aelf::MethodType.View,
+        __ServiceName,
+        "GetBalance",
+        __Marshaller_token_GetBalanceInput,
+        __Marshaller_token_GetBalanceOutput);
+
+    #endregion
+
+    #region Descriptors
+    public static global::Google.Protobuf.Reflection.ServiceDescriptor Descriptor
+    {
+      get { return global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0]; }
+    }
+
+    public static global::System.Collections.Generic.IReadOnlyList<global::Google.Protobuf.Reflection.ServiceDescriptor> Descriptors
+    {
+      get
+      {
+        return new global::System.Collections.Generic.List<global::Google.Protobuf.Reflection.ServiceDescriptor>()
+        {
+          global::AElf.Standards.ACS1.Acs1Reflection.Descriptor.Services[0],
+          global::AElf.Contracts.MultiToken.TokenReflection.Descriptor.Services[0],
+        };
+      }
+    }
+    #endregion
+
+    #region Fees
+    static readonly global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> __MethodFees =
+        new global::System.Collections.Generic.Dictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)>
+        {
+          { "Transfer", (1000, new (string Symbol, long Weight)[] { ("READ", 2), ("WRITE", 5) }) },
+          { "GetBalance", (0, new (string Symbol, long Weight)[] { }) },
+        };
+    public static global::System.Collections.Generic.IReadOnlyDictionary<string, (long BaseFee, (string Symbol, long Weight)[] ResourceWeights)> MethodFees => __MethodFees;
+    #endregion
+
+    public class TokenContractStub : aelf::ContractStubBase
+    {
+      aelf::IMethodStub<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> __SetMethodFee;
+
+      public aelf::IMethodStub<global::AElf.Standards.ACS1.MethodFees, global::Google.Protobuf.WellKnownTypes.Empty> SetMethodFee
+      {
+        get { return __SetMethodFee ?? (__SetMethodFee = __factory.Create(__Method_SetMethodFee)); }
+      }
+
+      /// <summary>Wraps the Task of SetMethodFee.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> SetMethodFeeCallValueTask(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(SetMethodFee.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of SetMethodFee.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> SetMethodFeeSendValueTask(global::AElf.Standards.ACS1.MethodFees input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(SetMethodFee.SendAsync(input));
+      }
+
+      aelf::IMethodStub<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> __GetMethodFee;
+
+      public aelf::IMethodStub<global::Google.Protobuf.WellKnownTypes.StringValue, global::AElf.Standards.ACS1.MethodFees> GetMethodFee
+      {
+        get { return __GetMethodFee ?? (__GetMethodFee = __factory.Create(__Method_GetMethodFee)); }
+      }
+
+      /// <summary>Wraps the Task of GetMethodFee.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::AElf.Standards.ACS1.MethodFees> GetMethodFeeCallValueTask(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::AElf.Standards.ACS1.MethodFees>(GetMethodFee.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of GetMethodFee.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Standards.ACS1.MethodFees>> GetMethodFeeSendValueTask(global::Google.Protobuf.WellKnownTypes.StringValue input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Standards.ACS1.MethodFees>>(GetMethodFee.SendAsync(input));
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __Transfer;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> Transfer
+      {
+        get { return __Transfer ?? (__Transfer = __factory.Create(__Method_Transfer)); }
+      }
+
+      /// <summary>Wraps the Task of Transfer.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> TransferCallValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(Transfer.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of Transfer.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> TransferSendValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(Transfer.SendAsync(input));
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> __BatchTransfer;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.TransferInput, global::Google.Protobuf.WellKnownTypes.Empty> BatchTransfer
+      {
+        get { return __BatchTransfer ?? (__BatchTransfer = __factory.Create(__Method_BatchTransfer)); }
+      }
+
+      /// <summary>Wraps the Task of BatchTransfer.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty> BatchTransferCallValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::Google.Protobuf.WellKnownTypes.Empty>(BatchTransfer.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of BatchTransfer.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>> BatchTransferSendValueTask(global::AElf.Contracts.MultiToken.TransferInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::Google.Protobuf.WellKnownTypes.Empty>>(BatchTransfer.SendAsync(input));
+      }
+
+      aelf::IMethodStub<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> __GetBalance;
+
+      public aelf::IMethodStub<global::AElf.Contracts.MultiToken.GetBalanceInput, global::AElf.Contracts.MultiToken.GetBalanceOutput> GetBalance
+      {
+        get { return __GetBalance ?? (__GetBalance = __factory.Create(__Method_GetBalance)); }
+      }
+
+      /// <summary>Wraps the Task of GetBalance.CallAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<global::AElf.Contracts.MultiToken.GetBalanceOutput> GetBalanceCallValueTask(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<global::AElf.Contracts.MultiToken.GetBalanceOutput>(GetBalance.CallAsync(input));
+      }
+
+      /// <summary>Wraps the Task of GetBalance.SendAsync; doesn't save its allocation.</summary>
+      public global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Contracts.MultiToken.GetBalanceOutput>> GetBalanceSendValueTask(global::AElf.Contracts.MultiToken.GetBalanceInput input)
+      {
+        return new global::System.Threading.Tasks.ValueTask<aelf::IExecutionResult<global::AElf.Contracts.MultiToken.GetBalanceOutput>>(GetBalance.SendAsync(input));
+      }
+
+    }
+  }
+}
+#endregion
+
@@ -0,0 +1,192 @@
+# Runs protoc with the contract plugin on one proto and checks the output.
+#
+# Required variables:
+#   PROTOC, PLUGIN       protoc and the plugin under test
+#   PROTO                the proto file to generate, relative to PROTO_DIR
+#   PROTO_DIR            directory of the test protos
+#   OPTIONS_DIR          directory of aelf_options.proto
+#   WELLKNOWN_DIR        directory of the well known protos
+#   OUTPUT_DIR           scratch directory of this test
+# Optional variables:
+#   PARAMETER            generator parameter, e.g. "stub,batch"
+#   GOLDEN_DIR           every file generated must match the file of the same
+#                        name in this directory, and no file may be missing
+#   GENERATE             "deep", "diamond" or "methods": writes a proto of
+#                        COUNT services or methods into OUTPUT_DIR first;
+#                        "single" writes a proto of one service, for names
+#                        that can't be checked in
+#   COUNT                size of the generated proto
+#   EXPECT_CONTAINS      text the output of a generated proto must contain
+#   EXPECT_SUFFIX        only outputs ending with it must contain the text
+#   RUNNER, MAX_SECONDS, MAX_RSS_KB
+#                        runs protoc through the budget runner
+#
+# Setting the environment variable UPDATE_GOLDEN copies the output over
+# GOLDEN_DIR instead of comparing.
+
+foreach(var PROTOC PLUGIN PROTO PROTO_DIR OPTIONS_DIR WELLKNOWN_DIR OUTPUT_DIR)
+  if(NOT DEFINED ${var})
+    message(FATAL_ERROR "${var} is not set")
+  endif()
+endforeach()
+
+file(REMOVE_RECURSE "${OUTPUT_DIR}")
+file(MAKE_DIRECTORY "${OUTPUT_DIR}/out")
+
+# Writes the lines in ${lines} to ${path} in chunks, so that building large
+# protos doesn't copy the whole content for every line.
+macro(flush_lines path)
+  file(APPEND "${path}" "${lines}")
+  set(lines "")
+endmacro()
+
+if(GENERATE)
+  set(PROTO_DIR "${OUTPUT_DIR}/protos")
+  file(MAKE_DIRECTORY "${PROTO_DIR}")
+  set(header "syntax = \"proto3\";\nimport \"aelf_options.proto\";\nimport \"google/protobuf/empty.proto\";\n")
+  set(empty "google.protobuf.Empty")
+  if(COUNT)
+    math(EXPR last "${COUNT} - 1")
+  endif()
+
+  if(GENERATE STREQUAL "deep")
+    # S0 <- S1 <- ... <- S<COUNT-2> in the base file, S<COUNT-1> in the
+    # generated file, so only the deepest service is written out.
+    set(base "${PROTO_DIR}/deep_base.proto")
+    file(WRITE "${base}" "${header}package deep;\noption csharp_namespace = \"Deep\";\n")
+    set(lines "")
+    math(EXPR last_base "${COUNT} - 2")
+    foreach(i RANGE 0 ${last_base})
+      set(lines "${lines}service S${i} { option (aelf.csharp_state) = \"Deep.State\";")
+      if(i GREATER 0)
+        math(EXPR prev "${i} - 1")
+        set(lines "${lines} option (aelf.base) = \"deep.S${prev}\";")
+      endif()
+      set(lines "${lines} rpc M${i} (${empty}) returns (${empty}); }\n")
+      math(EXPR chunk "${i} % 100")
+      if(chunk EQUAL 99)
+        flush_lines("${base}")
+      endif()
+    endforeach()
+    flush_lines("${base}")
+    file(WRITE "${PROTO_DIR}/${PROTO}" "${header}import \"deep_base.proto\";\npackage deep;\noption csharp_namespace = \"Deep\";\n"
+         "service S${last} { option (aelf.csharp_state) = \"Deep.State\"; option (aelf.base) = \"deep.S${last_base}\";"
+         " rpc M${last} (${empty}) returns (${empty}); }\n")
+
+  elseif(GENERATE STREQUAL "diamond")
+    # COUNT services sharing one root, all bases of a single service.
+    set(base "${PROTO_DIR}/diamond_base.proto")
+    file(WRITE "${base}" "${header}package diamond;\noption csharp_namespace = \"Diamond\";\n"
+         "service Root { option (aelf.csharp_state) = \"Diamond.State\"; rpc Ping (${empty}) returns (${empty}); }\n")
+    set(lines "")
+    set(bases "")
+    foreach(i RANGE 0 ${last})
+      set(lines "${lines}service B${i} { option (aelf.csharp_state) = \"Diamond.State\"; option (aelf.base) = \"diamond.Root\"; rpc M${i} (${empty}) returns (${empty}); }\n")
+      set(bases "${bases} option (aelf.base) = \"diamond.B${i}\";")
+      math(EXPR chunk "${i} % 100")
+      if(chunk EQUAL 99)
+        flush_lines("${base}")
+      endif()
+    endforeach()
+    flush_lines("${base}")
+    file(WRITE "${PROTO_DIR}/${PROTO}" "${header}import \"diamond_base.proto\";\npackage diamond;\noption csharp_namespace = \"Diamond\";\n"
+         "service Top { option (aelf.csharp_state) = \"Diamond.State\";${bases}"
+         " rpc Run (${empty}) returns (${empty}); }\n")
+
+  elseif(GENERATE STREQUAL "methods")
+    # One service with COUNT methods and one event.
+    set(path "${PROTO_DIR}/${PROTO}")
+    file(WRITE "${path}" "${header}package methods;\noption csharp_namespace = \"Methods\";\n"
+         "message Called { option (aelf.is_event) = true; string name = 1 [(aelf.is_indexed) = true]; int64 value = 2; }\n"
+         "service Methods { option (aelf.csharp_state) = \"Methods.State\";\n")
+    set(lines "")
+    foreach(i RANGE 0 ${last})
+      math(EXPR view "${i} % 2")
+      if(view)
+        set(lines "${lines}  rpc M${i} (${empty}) returns (${empty}) { option (aelf.is_view) = true; }\n")
+      else()
+        set(lines "${lines}  rpc M${i} (${empty}) returns (${empty}) { option (aelf.base_fee) = ${i}; }\n")
+      endif()
+      math(EXPR chunk "${i} % 100")
+      if(chunk EQUAL 99)
+        flush_lines("${path}")
+      endif()
+    endforeach()
+    set(lines "${lines}}\n")
+    flush_lines("${path}")
+
+  elseif(GENERATE STREQUAL "single")
+    file(WRITE "${PROTO_DIR}/${PROTO}" "${header}package single;\noption csharp_namespace = \"Single\";\n"
+         "service Single { option (aelf.csharp_state) = \"Single.State\"; rpc Run (${empty}) returns (${empty}); }\n")
+
+  else()
+    message(FATAL_ERROR "Unknown GENERATE value ${GENERATE}")
+  endif()
+endif()
+
+set(out "${OUTPUT_DIR}/out")
+if(PARAMETER)
+  set(out "${PARAMETER}:${out}")
+endif()
+set(command
+    "${PROTOC}"
+    "--plugin=protoc-gen-contract_csharp=${PLUGIN}"
+    "--contract_csharp_out=${out}"
+    "-I${PROTO_DIR}" "-I${OPTIONS_DIR}" "-I${WELLKNOWN_DIR}"
+    "${PROTO}")
+if(RUNNER)
+  set(command "${RUNNER}" "${MAX_SECONDS}" "${MAX_RSS_KB}" ${command})
+endif()
+execute_process(COMMAND ${command} RESULT_VARIABLE result)
+if(NOT result EQUAL 0)
+  message(FATAL_ERROR "protoc failed on ${PROTO} with parameter \"${PARAMETER}\": ${result}")
+endif()
+
+file(GLOB_RECURSE outputs RELATIVE "${OUTPUT_DIR}/out" "${OUTPUT_DIR}/out/*")
+if(NOT outputs)
+  message(FATAL_ERROR "No file generated for ${PROTO} with parameter \"${PARAMETER}\"")
+endif()
+
+if(EXPECT_CONTAINS)
+  foreach(output ${outputs})
+    if(EXPECT_SUFFIX AND NOT output MATCHES "${EXPECT_SUFFIX}$")
+      continue()
+    endif()
+    file(READ "${OUTPUT_DIR}/out/${output}" content)
+    string(FIND "${content}" "${EXPECT_CONTAINS}" found)
+    if(found EQUAL -1)
+      message(FATAL_ERROR "${output} doesn't contain \"${EXPECT_CONTAINS}\"")
+    endif()
+  endforeach()
+endif()
+
+if(GOLDEN_DIR)
+  if(DEFINED ENV{UPDATE_GOLDEN})
+    file(REMOVE_RECURSE "${GOLDEN_DIR}")
+    file(MAKE_DIRECTORY "${GOLDEN_DIR}")
+    foreach(output ${outputs})
+      configure_file("${OUTPUT_DIR}/out/${output}" "${GOLDEN_DIR}/${output}" COPYONLY)
+    endforeach()
+    return()
+  endif()
+
+  file(GLOB_RECURSE goldens RELATIVE "${GOLDEN_DIR}" "${GOLDEN_DIR}/*")
+  foreach(golden ${goldens})
+    list(FIND outputs "${golden}" index)
+    if(index EQUAL -1)
+      message(FATAL_ERROR "${golden} was not generated")
+    endif()
+  endforeach()
+  foreach(output ${outputs})
+    list(FIND goldens "${output}" index)
+    if(index EQUAL -1)
+      message(FATAL_ERROR "${output} has no golden file in ${GOLDEN_DIR}")
+    endif()
+    execute_process(COMMAND "${CMAKE_COMMAND}" -E compare_files
+                    "${OUTPUT_DIR}/out/${output}" "${GOLDEN_DIR}/${output}"
+                    RESULT_VARIABLE different)
+    if(different)
+      message(FATAL_ERROR "${output} differs from ${GOLDEN_DIR}/${output}")
+    endif()
+  endforeach()
+endif()
@@ -0,0 +1,80 @@
+/*
+ *
+ * Copyright 2015 gRPC authors. Modified by AElfProject.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Runs a command and fails if it, including the processes it waited for
+// (protoc waits for the plugin), took longer or used more memory than
+// allowed.
+//
+// Usage: run_with_budget <max_seconds> <max_rss_kb> <command> [args...]
+
+#include <cstdio>
+#include <cstdlib>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+int main(int argc, char* argv[]) {
+  if (argc < 4) {
+    fprintf(stderr, "Usage: %s <max_seconds> <max_rss_kb> <command> [args...]\n", argv[0]);
+    return 2;
+  }
+  double max_seconds = atof(argv[1]);
+  long max_rss_kb = atol(argv[2]);
+
+  struct timeval start;
+  gettimeofday(&start, NULL);
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    return 2;
+  }
+  if (pid == 0) {
+    execvp(argv[3], argv + 3);
+    perror(argv[3]);
+    _exit(127);
+  }
+
+  int status = 0;
+  struct rusage usage;
+  if (wait4(pid, &status, 0, &usage) < 0) {
+    perror("wait4");
+    return 2;
+  }
+  struct timeval end;
+  gettimeofday(&end, NULL);
+  double seconds = (end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1e6;
+  // The usage of a reaped child includes the children it reaped itself.
+  long rss_kb = usage.ru_maxrss;
+
+  printf("%s: %.2fs (budget %.2fs), peak RSS %ld KB (budget %ld KB)\n",
+         argv[3], seconds, max_seconds, rss_kb, max_rss_kb);
+  if (!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    fprintf(stderr, "%s failed with status %d\n", argv[3], status);
+    return 1;
+  }
+  if (max_seconds > 0 && seconds > max_seconds) {
+    fprintf(stderr, "Time budget exceeded\n");
+    return 1;
+  }
+  if (max_rss_kb > 0 && rss_kb > max_rss_kb) {
+    fprintf(stderr, "Memory budget exceeded\n");
+    return 1;
+  }
+  return 0;
+}